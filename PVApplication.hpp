@@ -5,6 +5,9 @@
 class PVApplication : public VApplication {
 public:
 	PVApplication() : VApplication() {
-
+#ifndef _DEBUG
+		/* Nothing Dumps the Profile Zones In the Release Build, Don't Record Them */
+		VProfiler::Instance().SetEnable(false);
+#endif
 	}
 };
\ No newline at end of file
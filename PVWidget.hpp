@@ -11,6 +11,7 @@
 #include <comutil.h>
 
 #include <map>
+#include <memory>
 #include <io.h>
 
 #ifdef _DEBUG
@@ -85,6 +86,9 @@ private:
 
 	bool          InDrag                 = false;
 
+	/* The Fast Zoom Is Scaled Again In High Quality Once the Zooming Stops */
+	VTimerHandle  ZoomRefineTimer;
+
 private:
 	void MouseDragStart() {
 		InDrag = true;
@@ -97,7 +101,9 @@ private:
 	}
 
 private:
-	void ZoomImage(int Width, int Height) {
+	void ZoomImage(int Width, int Height, bool HighQuality = true) {
+		VProfileScope("ZoomImage", "Image");
+
 		if (ZoomedImage != nullptr &&
 			ZoomedImage != InViewImage) {
 			delete ZoomedImage;
@@ -105,12 +111,27 @@ private:
 			ZoomedImage = nullptr;
 		}
 
-		ZoomedImage = new VImage(Width, Height);
+		/* a Picture Without Alpha Zooms Into an Opaque Image, So the Label Could Cull the Background */
+		ZoomedImage = new VImage(Width, Height, InViewImage->IsOpaque() == false);
 
 		VPainterDevice Painter(ZoomedImage);
 
+		Painter.SetHighQualityInterpolation(HighQuality);
 		Painter.DrawImage(InViewImage, { 0, 0, Width, Height });
 	}
+	/*
+	 * RefineZoomedImage Functional:
+	 *	@description  : Scale the Zoomed Image Again With the High Quality Filter
+	*/
+	void RefineZoomedImage() {
+		if (InViewImage == nullptr || ZoomedImage == nullptr || ZoomedImage == InViewImage) {
+			return;
+		}
+
+		ZoomImage(ImageViewLabel->GetWidth(), ImageViewLabel->GetHeight(), true);
+
+		ImageViewLabel->SetImage(ZoomedImage);
+	}
 
 private:
 	std::wstring PictureFilePath;
@@ -121,30 +142,114 @@ private:
 	PVLocalUISurface LocalSurface;
 
 private:
-	void ScanPicturePath(std::wstring Path, std::vector<std::wstring>& Files) {
-		intptr_t    FileHandle = NULL;
-		_finddata_t FileInfo;
-
-		std::string  FindPath;
-		std::wstring TempPath;
-		FindPath  = FindPath.assign(CodeConvert(Path.c_str())).append("*");
-
-		if ((FileHandle = _findfirst(FindPath.c_str(), &FileInfo)) != -1) {
-			do {
-				if (!(FileInfo.attrib & _A_SUBDIR)) {
-					TempPath = Path + CodeConvert(FileInfo.name);
-
-					if (TempPath.find(L".jpg")  == TempPath.size() - 4 ||
-						TempPath.find(L".png")  == TempPath.size() - 4 ||
-						TempPath.find(L".gif")  == TempPath.size() - 4 ||
-						TempPath.find(L".jpge") == TempPath.size() - 5 ||
-						TempPath.find(L".jpg")  == TempPath.size() - 4) {
-						Files.push_back(TempPath);
-					}
-				}
-			} while (_findnext(FileHandle, &FileInfo) == 0);
+	/*
+	 * FolderScanState struct:
+	 *	@description  : A Folder Scan In Progress, the Opened Picture Is Already In the Container
+	 *					And the Files Found Before It Are Inserted In Front Of It
+	*/
+	struct FolderScanState {
+		intptr_t     FileHandle  = -1;
+		_finddata_t  FileInfo;
+
+		std::wstring Path;
+		std::wstring OpenedPath;
+		size_t       OpenedIndex = 0;
+		bool         OpenedFound = false;
+
+		~FolderScanState() {
+			if (FileHandle != -1) {
+				_findclose(FileHandle);
+			}
+		}
+	};
+
+	VTaskHandle FolderScanTask;
+
+	/*
+	 * AddScannedFile Functional:
+	 *	@description  : Put the Current Entry Of the Scan Into PicturesContainer If It Is a Picture
+	*/
+	void AddScannedFile(FolderScanState& State) {
+		if (State.FileInfo.attrib & _A_SUBDIR) {
+			return;
+		}
+
+		std::wstring TempPath = State.Path + CodeConvert(State.FileInfo.name);
+
+		if (TempPath.find(L".jpg")  == TempPath.size() - 4 ||
+			TempPath.find(L".png")  == TempPath.size() - 4 ||
+			TempPath.find(L".gif")  == TempPath.size() - 4 ||
+			TempPath.find(L".jpge") == TempPath.size() - 5 ||
+			TempPath.find(L".jpg")  == TempPath.size() - 4) {
+			if (State.OpenedFound == true) {
+				PicturesContainer.push_back(TempPath);
+
+				return;
+			}
+			if (TempPath == State.OpenedPath) {
+				State.OpenedFound = true;
+
+				return;
+			}
+
+			PicturesContainer.insert(PicturesContainer.begin() + State.OpenedIndex, TempPath);
+
+			/* The Picture In View Moves Back With the Files Inserted Before It */
+			if (LocalContainerPosition >= static_cast<int>(State.OpenedIndex)) {
+				++LocalContainerPosition;
+			}
+
+			++State.OpenedIndex;
 		}
 	}
+	/*
+	 * ScanPicturePathSlice Functional:
+	 *	@description  : Read a Few Entries Of the Folder ( One Slice Of the Scan Job )
+	 *	@return value : Is There More To Read
+	*/
+	bool ScanPicturePathSlice(FolderScanState& State) {
+		if (State.FileHandle == -1) {
+			std::string FindPath = CodeConvert(State.Path.c_str());
+			FindPath.append("*");
+
+			if ((State.FileHandle = _findfirst(FindPath.c_str(), &State.FileInfo)) == -1) {
+				return false;
+			}
+		}
+
+		for (int Count = 0; Count < 64; ++Count) {
+			AddScannedFile(State);
+
+			if (_findnext(State.FileHandle, &State.FileInfo) != 0) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+	/*
+	 * StartScanPicturePath Functional:
+	 *	@description  : Show the Opened Picture At Once And Fill the Rest Of the Folder In Frame-budgeted Slices
+	*/
+	void StartScanPicturePath() {
+		VTaskQueue* TaskQueue = VCoreApplication::Instance()->GetTaskQueue();
+
+		TaskQueue->Cancel(FolderScanTask);
+
+		PicturesContainer.clear();
+		PicturesContainer.push_back(PictureFilePath);
+
+		LocalContainerPosition = 0;
+
+		std::shared_ptr<FolderScanState> State(new FolderScanState);
+
+		State->Path       = PictureLocalPath;
+		State->OpenedPath = PictureFilePath;
+
+		FolderScanTask = TaskQueue->Post([this, State]() -> bool {
+			return ScanPicturePathSlice(*State);
+		});
+	}
 
 	std::wstring GetPercentString(double Percent) {
 		if (Percent >= 1) {
@@ -273,15 +378,7 @@ private:
 			PictureFileName  = PictureFilePath.substr(SliptPosition, PictureFilePath.size() - SliptPosition);
 			PictureLocalPath = PictureFilePath.substr(0, SliptPosition);
 
-			ScanPicturePath(PictureLocalPath, PicturesContainer);
-
-			for (auto& Path : PicturesContainer) {
-				if (Path == PictureFilePath) {
-					break;
-				}
-
-				++LocalContainerPosition;
-			}
+			StartScanPicturePath();
 
 			return true;
 		}
@@ -295,138 +392,199 @@ private:
 
 	bool   FirstTimeDrag = true;
 
-	time_t DealyClock = 0;
+private:
+	/*
+	 * Input Requests Accumulated Between Two Frames, Applied Once Per Frame In CheckFrame
+	*/
+	int    PendingZoomSteps  = 0;
+	int    PendingNavigation = 0;
+	bool   PendingDrag       = false;
+	bool   PendingZoomReset  = false;
 
 private:
 	void DealyMessage(VMessage* Message) override {
-		if (clock() - DealyClock >= 100) {
-			DealyClock = clock();
+		if (Message->GetType() == VMessageType::KeyClickedMessage) {
+			VKeyClickedMessage* KeyMessage = static_cast<VKeyClickedMessage*>(Message);
 
-			if (Message->GetType() == VMessageType::KeyClickedMessage) {
-				VKeyClickedMessage* KeyMessage = static_cast<VKeyClickedMessage*>(Message);
-
-				if (KeyMessage->KeyPrevDown == true) {
-					if (KeyMessage->KeyVKCode == VK_LEFT &&
-						LocalContainerPosition - 1 >= 0) {
-						if (ZoomedImage == InViewImage) {
-							ZoomedImage = nullptr;
-						}
+			if (KeyMessage->KeyPrevDown == true) {
+#ifdef _DEBUG
+				/* F11 : Toggle the Frame-time Graph, F12 : Dump the Profile Zones ( Debug Build Only ) */
+				if (KeyMessage->KeyVKCode == VK_F11) {
+					SetFrameGraphVisible(!IsFrameGraphVisible());
+				}
+				if (KeyMessage->KeyVKCode == VK_F12) {
+					VProfiler::Instance().DumpChromeTrace(L"PhotoViewer.trace.json");
+				}
+#endif
 
-						delete InViewImage;
-						InViewImage = nullptr;
+				if (KeyMessage->KeyVKCode == VK_LEFT) {
+					PendingNavigation -= KeyMessage->KeyRepeatCount;
+				}
+				if (KeyMessage->KeyVKCode == VK_RIGHT) {
+					PendingNavigation += KeyMessage->KeyRepeatCount;
+				}
+			}
+		}
+		if (Message->GetType() == VMessageType::MouseMoveMessage) {
+			if (InDrag == true) {
+				VMouseMoveMessage* MouseMessage = static_cast<VMouseMoveMessage*>(Message);
 
-						if (ZoomedImage != nullptr) {
-							delete ZoomedImage;
-							ZoomedImage = nullptr;
-						}
+				if (FirstTimeDrag == true) {
+					MouseDragPoint = MouseMessage->MousePosition;
 
-						--LocalContainerPosition;
+					FirstTimeDrag = false;
+				}
+				else {
+					ImageOffsetPoint.x = -(MouseDragPoint.x - MouseMessage->MousePosition.x);
+					ImageOffsetPoint.y = -(MouseDragPoint.y - MouseMessage->MousePosition.y);
 
-						PictureFilePath = PicturesContainer[LocalContainerPosition];
+					PendingDrag = true;
+				}
+			}
+		}
+		if (Message->GetType() == VMessageType::MouseWheelMessage) {
+			VMouseWheelMessage* WheelMessage = static_cast<VMouseWheelMessage*>(Message);
 
-						int SliptPosition = static_cast<int>(PictureFilePath.find_last_of(L"\\")) + 1;
+			/* The Wheel Deltas Are Summed Up, One Notch ( WHEEL_DELTA ) Is One Zoom Step */
+			int ZoomSteps = WheelMessage->WheelValue / WHEEL_DELTA;
 
-						PictureFileName = PictureFilePath.substr(SliptPosition, PictureFilePath.size() - SliptPosition);
+			if (ZoomSteps == 0 && WheelMessage->WheelValue != 0) {
+				ZoomSteps = WheelMessage->WheelValue > 0 ? 1 : -1;
+			}
 
-						InitPicture();
-						ConfigMainUI();
-					}
-					if (KeyMessage->KeyVKCode == VK_RIGHT &&
-						LocalContainerPosition + 1 < PicturesContainer.size()) {
-						if (ZoomedImage == InViewImage) {
-							ZoomedImage = nullptr;
-						}
+			PendingZoomSteps += ZoomSteps;
+		}
+	}
 
-						delete InViewImage;
-						InViewImage = nullptr;
+public:
+	/*
+	 * CheckFrame override Functional:
+	 *	@description  : Apply the Accumulated Input Once, Then Paint the Frame
+	*/
+	void CheckFrame() override {
+		if (LocalSurface == PVLocalUISurface::MainUI) {
+			ApplyPendingInput();
+		}
+		else {
+			PendingZoomSteps  = 0;
+			PendingNavigation = 0;
+			PendingDrag       = false;
+			PendingZoomReset  = false;
+		}
 
-						if (ZoomedImage != nullptr) {
-							delete ZoomedImage;
-							ZoomedImage = nullptr;
-						}
+		VMainWindow::CheckFrame();
+	}
 
-						++LocalContainerPosition;
+private:
+	/*
+	 * ApplyPendingInput Functional:
+	 *	@description  : Switch Picture, Zoom And Drag According To the Accumulated Requests,
+	 *					So the Image Is Zoomed And the UI Is Configured At Most Once Per Frame
+	*/
+	void ApplyPendingInput() {
+		bool NeedConfig = PendingDrag;
+		bool NeedZoom   = false;
+
+		if (PendingNavigation != 0) {
+			int TargetPosition = LocalContainerPosition + PendingNavigation;
+
+			TargetPosition = TargetPosition < 0 ? 0 : TargetPosition;
+			TargetPosition = TargetPosition >= static_cast<int>(PicturesContainer.size()) ?
+				static_cast<int>(PicturesContainer.size()) - 1 : TargetPosition;
+
+			if (TargetPosition != LocalContainerPosition && TargetPosition >= 0) {
+				SwitchPicture(TargetPosition);
+
+				NeedConfig = true;
+			}
+		}
+		if (PendingZoomReset == true) {
+			ImageOffsetPoint = { 0, 0 };
 
-						PictureFilePath = PicturesContainer[LocalContainerPosition];
+			ZoomedSize = 1;
 
-						int SliptPosition = static_cast<int>(PictureFilePath.find_last_of(L"\\")) + 1;
+			NeedZoom   = true;
+		}
 
-						PictureFileName = PictureFilePath.substr(SliptPosition, PictureFilePath.size() - SliptPosition);
+		for (; PendingZoomSteps > 0; --PendingZoomSteps) {
+			if (ZoomedSize + 0.2 <= 8) {
+				ZoomedSize += 0.2;
+			}
 
-						InitPicture();
-						ConfigMainUI();
-					}
-				}
+			NeedZoom = true;
+		}
+		for (; PendingZoomSteps < 0; ++PendingZoomSteps) {
+			if (ZoomedSize - 0.2 >= 0.05) {
+				ZoomedSize -= 0.2;
 			}
-			if (Message->GetType() == VMessageType::MouseMoveMessage) {
-				if (InDrag == true) {
-					VMouseMoveMessage* MouseMessage = static_cast<VMouseMoveMessage*>(Message);
 
-					if (FirstTimeDrag == true) {
-						MouseDragPoint = MouseMessage->MousePosition;
+			NeedZoom = true;
+		}
 
-						FirstTimeDrag = false;
-					}
-					else {
-						ImageOffsetPoint.x = -(MouseDragPoint.x - MouseMessage->MousePosition.x);
-						ImageOffsetPoint.y = -(MouseDragPoint.y - MouseMessage->MousePosition.y);
+		if (NeedZoom == true) {
+			ImageViewLabel->Resize(InViewImage->GetWidth() * ZoomedSize, InViewImage->GetHeight() * ZoomedSize);
 
-						ConfigMainUI();
-					}
-				}
-			}
-			if (Message->GetType() == VMessageType::MouseWheelMessage) {
-				VMouseWheelMessage* WheelMessage = static_cast<VMouseWheelMessage*>(Message);
+			/* Zoom Fast While the Wheel Is Turning, Refine After It Rests */
+			ZoomImage(ImageViewLabel->GetWidth(), ImageViewLabel->GetHeight(), false);
 
-				if (WheelMessage->WheelValue > 0) {
-					ZoomUp();
-				}
-				else {
-					ZoomDown();
-				}
-			}
-		}
-	}
+			VCoreApplication::Instance()->GetTimerWheel()->Debounce(ZoomRefineTimer, 150, [this]() {
+				RefineZoomedImage();
+			});
 
-private:
-	void ZoomUp() {
-		if (ZoomedSize + 0.2 <= 8) {
-			ZoomedSize += 0.2;
+			ZoomPercentText->SetPlaneText(GetPercentString(ZoomedSize));
+
+			NeedConfig = true;
 		}
 
-		ImageViewLabel->Resize(InViewImage->GetWidth() * ZoomedSize, InViewImage->GetHeight() * ZoomedSize);
+		if (NeedConfig == true) {
+			ConfigMainUI();
+		}
 
-		ZoomImage(ImageViewLabel->GetWidth(), ImageViewLabel->GetHeight());
+		PendingNavigation = 0;
+		PendingDrag       = false;
+		PendingZoomReset  = false;
+	}
 
-		ZoomPercentText->SetPlaneText(GetPercentString(ZoomedSize));
+	/*
+	 * SwitchPicture Functional:
+	 *	@description  : Load the Picture At Position Of the Folder
+	*/
+	void SwitchPicture(int Position) {
+		VCoreApplication::Instance()->GetTimerWheel()->Cancel(ZoomRefineTimer);
 
-		ConfigMainUI();
-	}
-	void ZoomDown() {
-		if (ZoomedSize - 0.2 >= 0.05) {
-			ZoomedSize -= 0.2;
+		if (ZoomedImage == InViewImage) {
+			ZoomedImage = nullptr;
 		}
 
-		ImageViewLabel->Resize(InViewImage->GetWidth() * ZoomedSize, InViewImage->GetHeight() * ZoomedSize);
+		delete InViewImage;
+		InViewImage = nullptr;
 
-		ZoomImage(ImageViewLabel->GetWidth(), ImageViewLabel->GetHeight());
-
-		ZoomPercentText->SetPlaneText(GetPercentString(ZoomedSize));
+		if (ZoomedImage != nullptr) {
+			delete ZoomedImage;
+			ZoomedImage = nullptr;
+		}
 
-		ConfigMainUI();
-	}
-	void ZoomReset() {
-		ImageOffsetPoint = { 0, 0 };
+		LocalContainerPosition = Position;
 
-		ZoomedSize = 1;
+		PictureFilePath = PicturesContainer[LocalContainerPosition];
 
-		ImageViewLabel->Resize(InViewImage->GetWidth() * ZoomedSize, InViewImage->GetHeight() * ZoomedSize);
+		int SliptPosition = static_cast<int>(PictureFilePath.find_last_of(L"\\")) + 1;
 
-		ZoomImage(ImageViewLabel->GetWidth(), ImageViewLabel->GetHeight());
+		PictureFileName = PictureFilePath.substr(SliptPosition, PictureFilePath.size() - SliptPosition);
 
-		ZoomPercentText->SetPlaneText(GetPercentString(ZoomedSize));
+		InitPicture();
+	}
 
-		ConfigMainUI();
+private:
+	void ZoomUp() {
+		++PendingZoomSteps;
+	}
+	void ZoomDown() {
+		--PendingZoomSteps;
+	}
+	void ZoomReset() {
+		PendingZoomSteps = 0;
+		PendingZoomReset = true;
 	}
 
 private:
@@ -574,15 +732,7 @@ public:
 		PictureFileName = PictureFilePath.substr(SliptPosition, PictureFilePath.size() - SliptPosition);
 		PictureLocalPath = PictureFilePath.substr(0, SliptPosition);
 
-		ScanPicturePath(PictureLocalPath, PicturesContainer);
-
-		for (auto& Path : PicturesContainer) {
-			if (Path == PictureFilePath) {
-				break;
-			}
-
-			++LocalContainerPosition;
-		}
+		StartScanPicturePath();
 
 		StartupSurface.Hide();
 		MainSurface.Show();
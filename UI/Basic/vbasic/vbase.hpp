@@ -169,6 +169,28 @@ public:
 		return left <= Rect.left && top <= Rect.top &&
 			bottom >= Rect.bottom && right >= Rect.right;
 	}
+	/*
+	 * IsEmpty Functional:
+	 *	@description  : Is the Rect Own No Aera
+	 *	@return value : Yes or No
+	*/
+	bool IsEmpty() {
+		return left >= right || top >= bottom;
+	}
+	/*
+	 * Intersect Functional:
+	 *	@description  : Get the Common Aera Of Two Rects
+	 *	@return value : The Common Aera ( Empty If Not Overlap )
+	*/
+	_VRect Intersect(_VRect Rect) {
+		_VRect Result(max(left, Rect.left), max(top, Rect.top), min(right, Rect.right), min(bottom, Rect.bottom));
+
+		if (Result.IsEmpty() == true) {
+			return _VRect();
+		}
+
+		return Result;
+	}
 
 	/*
 	 * ToGdiplusRect Functional:
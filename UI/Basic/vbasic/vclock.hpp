@@ -0,0 +1,132 @@
+﻿/*
+ * VClock.hpp
+ *	@description : The Monotonic Time Source Of the Library
+ *	@birth		 : 2022/7.19
+*/
+
+#pragma once
+
+#include "vbase.hpp"
+
+#include <chrono>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VClockSource class:
+ *	@description  : Where the Time Comes From ( Microseconds, Never Goes Back )
+*/
+class VClockSource {
+public:
+	virtual ~VClockSource() {
+	}
+
+	virtual long long Now() = 0;
+};
+
+/*
+ * VSteadyClockSource class:
+ *	@description  : The Wall Time On std::chrono::steady_clock
+*/
+class VSteadyClockSource : public VClockSource {
+private:
+	std::chrono::steady_clock::time_point Epoch;
+
+public:
+	VSteadyClockSource() {
+		Epoch = std::chrono::steady_clock::now();
+	}
+
+	long long Now() override {
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - Epoch).count();
+	}
+};
+
+/*
+ * VManualClockSource class:
+ *	@description  : A Clock That Only Moves When Told To ( For Deterministic Runs )
+*/
+class VManualClockSource : public VClockSource {
+private:
+	long long Time = 0;
+
+public:
+	long long Now() override {
+		return Time;
+	}
+
+	/*
+	 * Advance Functional:
+	 *	@description  : Move the Time Forward ( Microseconds )
+	*/
+	void Advance(long long Delta) {
+		Time += Delta > 0 ? Delta : 0;
+	}
+};
+
+/*
+ * VClock class:
+ *	@description  : The Library Clock, Now() Is the Live Time, FrameTime() Is Sampled Once Per
+ *					Loop Turn So Every Timer And Animation In a Frame Sees the Same Time
+*/
+class VClock {
+private:
+	VSteadyClockSource SteadySource;
+	VClockSource*      Source;
+
+	long long          FrameTimeStamp;
+
+private:
+	VClock() {
+		Source         = &SteadySource;
+		FrameTimeStamp = Source->Now();
+	}
+
+public:
+	/*
+	 * Instance Functional:
+	 *	@description  : Get the Global Clock
+	*/
+	static VClock& Instance() {
+		static VClock GlobalClock;
+
+		return GlobalClock;
+	}
+
+	VClock(const VClock&) = delete;
+	void operator=(const VClock&) = delete;
+
+	/*
+	 * SetSource Functional:
+	 *	@description  : Replace the Time Source ( nullptr Restores the Steady Clock ), the Caller Owns It
+	*/
+	void SetSource(VClockSource* NewSource) {
+		Source         = NewSource != nullptr ? NewSource : &SteadySource;
+		FrameTimeStamp = Source->Now();
+	}
+
+	/*
+	 * Now Functional:
+	 *	@description  : The Live Time ( Microseconds )
+	*/
+	long long Now() {
+		return Source->Now();
+	}
+
+	/*
+	 * SampleFrameTime Functional:
+	 *	@description  : Take the Timestamp Of This Loop Turn ( UI Thread Only )
+	*/
+	void SampleFrameTime() {
+		FrameTimeStamp = Source->Now();
+	}
+	/*
+	 * FrameTime Functional:
+	 *	@description  : The Timestamp Of This Loop Turn ( Microseconds )
+	*/
+	long long FrameTime() const {
+		return FrameTimeStamp;
+	}
+};
+
+VLIB_END_NAMESPACE
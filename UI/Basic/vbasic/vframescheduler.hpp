@@ -0,0 +1,151 @@
+﻿/*
+ * VFrameScheduler.hpp
+ *	@description : Pace the Frames On a Display Cadence
+ *	@birth		 : 2022/7.15
+*/
+
+#pragma once
+
+#include "vbase.hpp"
+#include "vclock.hpp"
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VFrameStatistics struct:
+ *	@description  : The Frame-time Statistics ( Microseconds )
+*/
+struct VFrameStatistics {
+	/* How Many Frames Have Been Painted */
+	unsigned long long FrameCount = 0;
+	/* How Many Frames Missed Their Slot ( Took Longer Than One Interval ) */
+	unsigned long long DroppedFrameCount = 0;
+
+	long long          LastFrameTime = 0;
+	long long          MaxFrameTime = 0;
+	double             AverageFrameTime = 0;
+
+	/* The Recent Frame Times, HistoryPosition Points To the Oldest One */
+	static const int   HistorySize = 120;
+	long long          History[HistorySize] = { 0 };
+	int                HistoryPosition = 0;
+};
+
+/*
+ * VFrameScheduler class:
+ *	@description  : Decide When a Frame Slot Is Reached, Slots Are Aligned To a Fixed
+ *					Cadence On the Library Clock So Frames Don't Drift Or Jitter ( Microseconds )
+*/
+class VFrameScheduler {
+private:
+	long long         CadenceAnchor;
+	long long         NextFrameSlot;
+	long long         FrameStart;
+
+	long long         FrameInterval;
+
+	VFrameStatistics  Statistics;
+
+public:
+	/*
+	 * Build up Functional
+	*/
+
+	VFrameScheduler(int RefreshRate = 60) {
+		CadenceAnchor = VClock::Instance().Now();
+		NextFrameSlot = CadenceAnchor;
+		FrameStart    = CadenceAnchor;
+
+		SetRefreshRate(RefreshRate);
+	}
+
+	/*
+	 * SetRefreshRate Functional:
+	 *	@description  : Set the Target Display Cadence ( Frames Per Second )
+	*/
+	void SetRefreshRate(int RefreshRate) {
+		if (RefreshRate <= 1) {
+			RefreshRate = 60;
+		}
+
+		FrameInterval = 1000000 / RefreshRate;
+	}
+	/*
+	 * GetFrameInterval Functional:
+	 *	@description  : Get the Interval Between Two Slots ( Microseconds )
+	*/
+	long long GetFrameInterval() const {
+		return FrameInterval;
+	}
+
+	/*
+	 * IsFrameSlot Functional:
+	 *	@description  : Is the Next Frame Slot Reached
+	*/
+	bool IsFrameSlot() const {
+		return VClock::Instance().Now() >= NextFrameSlot;
+	}
+	/*
+	 * AdvanceSlot Functional:
+	 *	@description  : Move To the First Aligned Slot After Now
+	*/
+	void AdvanceSlot() {
+		long long SinceAnchor = VClock::Instance().Now() - CadenceAnchor;
+
+		NextFrameSlot = CadenceAnchor + (SinceAnchor / FrameInterval + 1) * FrameInterval;
+	}
+	/*
+	 * GetTimeToNextSlot Functional:
+	 *	@description  : How Long Until Next Slot ( Microseconds, 0 If Already Reached )
+	*/
+	long long GetTimeToNextSlot() const {
+		long long Rest = NextFrameSlot - VClock::Instance().Now();
+
+		return Rest > 0 ? Rest : 0;
+	}
+
+	/*
+	 * BeginFrame Functional:
+	 *	@description  : Mark a Frame Start Painting
+	*/
+	void BeginFrame() {
+		FrameStart = VClock::Instance().Now();
+	}
+	/*
+	 * EndFrame Functional:
+	 *	@description  : Mark the Frame Painted And Record Its Time
+	*/
+	void EndFrame() {
+		long long FrameTime = VClock::Instance().Now() - FrameStart;
+
+		++Statistics.FrameCount;
+
+		if (FrameTime > FrameInterval) {
+			++Statistics.DroppedFrameCount;
+		}
+
+		Statistics.LastFrameTime = FrameTime;
+		Statistics.MaxFrameTime  = FrameTime > Statistics.MaxFrameTime ? FrameTime : Statistics.MaxFrameTime;
+		Statistics.AverageFrameTime += (FrameTime - Statistics.AverageFrameTime) / static_cast<double>(Statistics.FrameCount);
+
+		Statistics.History[Statistics.HistoryPosition] = FrameTime;
+		Statistics.HistoryPosition = (Statistics.HistoryPosition + 1) % VFrameStatistics::HistorySize;
+	}
+
+	/*
+	 * GetStatistics Functional:
+	 *	@description  : Get the Frame-time Statistics
+	*/
+	const VFrameStatistics& GetStatistics() const {
+		return Statistics;
+	}
+	/*
+	 * ResetStatistics Functional:
+	 *	@description  : Clear the Frame-time Statistics
+	*/
+	void ResetStatistics() {
+		Statistics = VFrameStatistics();
+	}
+};
+
+VLIB_END_NAMESPACE
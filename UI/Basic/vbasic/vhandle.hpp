@@ -0,0 +1,108 @@
+﻿/*
+ * VHandle.hpp
+ *	@description : Generational Integer Handles And the Handle Table
+ *	@birth		 : 2022/7.17
+*/
+
+#pragma once
+
+#include "vbase.hpp"
+
+#include <vector>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VObjectHandle struct:
+ *	@description  : A Slot Index With the Slot's Generation, Released Slots Bump Their Generation
+ *					So Old Handles Never Resolve To a New Object ( Generation 0 Means Invalid )
+*/
+struct VObjectHandle {
+	unsigned int Index      = 0;
+	unsigned int Generation = 0;
+
+	bool IsValid() const {
+		return Generation != 0;
+	}
+
+	bool operator==(const VObjectHandle& Handle) const {
+		return Index == Handle.Index && Generation == Handle.Generation;
+	}
+	bool operator!=(const VObjectHandle& Handle) const {
+		return !(*this == Handle);
+	}
+};
+
+/*
+ * VHandleTable class:
+ *	@description  : Map Handles To Objects, Slots Are Reused Through a Free List
+*/
+template<class _Type>
+class VHandleTable {
+private:
+	struct VHandleSlot {
+		_Type*       Object;
+		unsigned int Generation;
+	};
+
+	std::vector<VHandleSlot>  Slots;
+	std::vector<unsigned int> FreeSlots;
+
+public:
+	/*
+	 * Allocate Functional:
+	 *	@description  : Give the Object a New Handle
+	*/
+	VObjectHandle Allocate(_Type* Object) {
+		VObjectHandle Handle;
+
+		if (FreeSlots.empty() == false) {
+			Handle.Index = FreeSlots.back();
+			FreeSlots.pop_back();
+		}
+		else {
+			Handle.Index = static_cast<unsigned int>(Slots.size());
+			Slots.push_back({ nullptr, 1 });
+		}
+
+		Slots[Handle.Index].Object = Object;
+		Handle.Generation          = Slots[Handle.Index].Generation;
+
+		return Handle;
+	}
+	/*
+	 * Release Functional:
+	 *	@description  : Invalidate the Handle And Recycle Its Slot
+	*/
+	void Release(VObjectHandle Handle) {
+		if (Get(Handle) == nullptr) {
+			return;
+		}
+
+		VHandleSlot& Slot = Slots[Handle.Index];
+
+		Slot.Object = nullptr;
+
+		/* Skip Generation 0, It Marks Invalid Handles */
+		if (++Slot.Generation == 0) {
+			++Slot.Generation;
+		}
+
+		FreeSlots.push_back(Handle.Index);
+	}
+
+	/*
+	 * Get Functional:
+	 *	@description  : Resolve a Handle
+	 *	@return value : The Object, nullptr If the Handle Is Stale
+	*/
+	_Type* Get(VObjectHandle Handle) const {
+		if (Handle.Index >= Slots.size() || Slots[Handle.Index].Generation != Handle.Generation) {
+			return nullptr;
+		}
+
+		return Slots[Handle.Index].Object;
+	}
+};
+
+VLIB_END_NAMESPACE
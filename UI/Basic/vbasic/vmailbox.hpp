@@ -0,0 +1,188 @@
+﻿/*
+ * VMailbox.hpp
+ *	@description : A Lock-free Multi-producer Single-consumer Queue Of Calls For the UI Thread
+ *	@birth		 : 2022/7.19
+*/
+
+#pragma once
+
+#include "vbase.hpp"
+
+#include <atomic>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VMailboxTask class:
+ *	@description  : A Posted Call, the Node Is the Task Itself ( Intrusive, One Allocation Per Post )
+*/
+class VMailboxTask {
+public:
+	std::atomic<VMailboxTask*> Next;
+
+public:
+	VMailboxTask() : Next(nullptr) {
+	}
+	virtual ~VMailboxTask() {
+	}
+
+	/*
+	 * Run Functional:
+	 *	@description  : Called On the Consumer Thread
+	*/
+	virtual void Run() {
+	}
+};
+
+/*
+ * VMailbox class:
+ *	@description  : Intrusive MPSC Queue ( Dmitry Vyukov ), Producers Only Do One Exchange,
+ *					the Consumer Never Locks. The Waker Is Called Once Per Batch Of Posts
+*/
+class VMailbox {
+public:
+	using WakerFunction = void(*)(void*);
+
+private:
+	/* Producers Push At the Head, the Consumer Pops At the Tail */
+	std::atomic<VMailboxTask*> Head;
+	VMailboxTask*              Tail;
+	VMailboxTask               Stub;
+
+	/* Set By the First Post After a Drain, Later Posts Do Not Wake Again */
+	std::atomic<bool>          WakePending;
+
+	std::atomic<WakerFunction> Waker;
+	std::atomic<void*>         WakerContext;
+
+private:
+	/*
+	 * Push Functional:
+	 *	@description  : Link a Node At the Head ( Wait-free )
+	*/
+	void Push(VMailboxTask* Task) {
+		Task->Next.store(nullptr, std::memory_order_relaxed);
+
+		VMailboxTask* Previous = Head.exchange(Task, std::memory_order_acq_rel);
+
+		/* Between the Exchange And This Store the Consumer Sees a Broken Link And Stops Early */
+		Previous->Next.store(Task, std::memory_order_release);
+	}
+
+	/*
+	 * Pop Functional:
+	 *	@description  : Unlink the Oldest Node
+	 *	@return value : The Node, nullptr If Empty Or a Producer Is Still Linking
+	*/
+	VMailboxTask* Pop() {
+		VMailboxTask* LocalTail = Tail;
+		VMailboxTask* Next      = LocalTail->Next.load(std::memory_order_acquire);
+
+		if (LocalTail == &Stub) {
+			if (Next == nullptr) {
+				return nullptr;
+			}
+
+			Tail      = Next;
+			LocalTail = Next;
+			Next      = Next->Next.load(std::memory_order_acquire);
+		}
+
+		if (Next != nullptr) {
+			Tail = Next;
+
+			return LocalTail;
+		}
+
+		if (LocalTail != Head.load(std::memory_order_acquire)) {
+			return nullptr;
+		}
+
+		/* The Last Node Can Only Be Taken Once the Stub Is Behind It */
+		Push(&Stub);
+
+		Next = LocalTail->Next.load(std::memory_order_acquire);
+
+		if (Next != nullptr) {
+			Tail = Next;
+
+			return LocalTail;
+		}
+
+		return nullptr;
+	}
+
+public:
+	/*
+	 * Build up & Deleter Functional
+	*/
+
+	VMailbox() : Head(&Stub), Tail(&Stub), WakePending(false), Waker(nullptr), WakerContext(nullptr) {
+	}
+	~VMailbox() {
+		/* Never Run Tasks Here, Their Targets May Already Be Gone */
+		for (VMailboxTask* Task = Pop(); Task != nullptr; Task = Pop()) {
+			delete Task;
+		}
+	}
+
+	VMailbox(const VMailbox&) = delete;
+	void operator=(const VMailbox&) = delete;
+
+	/*
+	 * SetWaker Functional:
+	 *	@description  : Set Who Is Woken Up When Mail Arrives ( nullptr To Clear )
+	*/
+	void SetWaker(WakerFunction Function, void* Context) {
+		WakerContext.store(Context);
+		Waker.store(Function);
+	}
+
+	/*
+	 * Post Functional:
+	 *	@description  : Hand a Task To the Consumer ( Any Thread ), the Mailbox Owns It From Now
+	*/
+	void Post(VMailboxTask* Task) {
+		Push(Task);
+
+		/* Only the First Post Of a Batch Pays For the Wake-up */
+		if (WakePending.exchange(true) == false) {
+			WakerFunction Function = Waker.load();
+
+			if (Function != nullptr) {
+				Function(WakerContext.load());
+			}
+		}
+	}
+
+	/*
+	 * Drain Functional:
+	 *	@description  : Run And Delete Every Posted Task ( Consumer Thread Only )
+	 *	@return value : How Many Tasks Ran
+	*/
+	size_t Drain() {
+		/* Cleared Before Popping, a Post We Can Not See Yet Wakes Us Again */
+		if (WakePending.exchange(false) == false) {
+			return 0;
+		}
+
+		size_t RunCount = 0;
+
+		for (VMailboxTask* Task = Pop(); Task != nullptr; Task = Pop()) {
+			Task->Run();
+
+			delete Task;
+
+			++RunCount;
+		}
+
+		return RunCount;
+	}
+};
+
+/*
+ * The Mailbox Of the UI Thread, Drained Once Per Loop Turn
+*/
+VMailbox _VL_UI_Mailbox;
+
+VLIB_END_NAMESPACE
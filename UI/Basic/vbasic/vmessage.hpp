@@ -8,6 +8,11 @@
 #include "../../render/vrender/vcanvas.hpp"
 #include "vbase.hpp"
 
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 VLIB_BEGIN_NAMESPACE
 
 /*
@@ -167,13 +172,17 @@ public:
 	bool			KeyExtened;
 	VkeyClickedFlag KeyStats;
 
+	/* How Many Auto-repeat Messages Were Merged Into This One */
+	unsigned short  KeyRepeatCount;
+
 public:
 	VKeyClickedMessage(byte VKCode, bool PrevDown, bool Extened, VkeyClickedFlag Stats)
 		: VMessage(VMessageType::KeyClickedMessage)  {
-		KeyVKCode   = VKCode;
-		KeyPrevDown = PrevDown;
-		KeyExtened  = Extened;
-		KeyStats    = Stats;
+		KeyVKCode      = VKCode;
+		KeyPrevDown    = PrevDown;
+		KeyExtened     = Extened;
+		KeyStats       = Stats;
+		KeyRepeatCount = 1;
 	}
 };
 
@@ -199,15 +208,15 @@ public:
 class VGetRepaintAeraMessage : public VMessage {
 public:
 	/*
-	 * RepaintAera ptr VRect:
-	 *	@description  : If this Rect Need Change, Use This Reference To Reset the Aera
+	 * RepaintAera VRect:
+	 *	@description  : The Aera Being Repainted, Objects Grow It When They Need More
 	*/
-	VRect* RepaintAera;
+	VRect RepaintAera;
 
 public:
 	VGetRepaintAeraMessage(VRect RepaintRegion)
 		: VMessage(VMessageType::GetRepaintAeraMessage) {
-		RepaintAera = &RepaintRegion;
+		RepaintAera = RepaintRegion;
 	}
 };
 
@@ -241,4 +250,65 @@ public:
 	}
 };
 
+/*
+ * VMessageStorageSize Functional:
+ *	@description  : The Biggest Size Among the Message Types
+*/
+template<class _Message>
+constexpr size_t VMessageStorageSize() {
+	return sizeof(_Message);
+}
+template<class _Message, class _NextMessage, class... _RestMessage>
+constexpr size_t VMessageStorageSize() {
+	return sizeof(_Message) > VMessageStorageSize<_NextMessage, _RestMessage...>() ?
+		sizeof(_Message) : VMessageStorageSize<_NextMessage, _RestMessage...>();
+}
+
+/*
+ * VInputMessageStorage class:
+ *	@description  : In-place Storage For One Input Message, Input Messages Are Plain Data
+ *					So They Are Built Here Without Heap Allocation And Never Need Destruction
+*/
+class VInputMessageStorage {
+public:
+	static const size_t StorageSize = VMessageStorageSize<VMouseMoveMessage, VMouseWheelMessage,
+		VMouseClickedMessage, VKeyClickedMessage, VIMECharMessage, VCheckFocusMessage>();
+
+private:
+	alignas(alignof(std::max_align_t)) unsigned char Buffer[StorageSize];
+
+	bool HasMessage = false;
+
+public:
+	/*
+	 * Emplace Functional:
+	 *	@description  : Build a Message In the Storage ( Replace the Old One )
+	*/
+	template<class _Message, class... _Args>
+	_Message* Emplace(_Args&&... Args) {
+		static_assert(sizeof(_Message) <= StorageSize, "The Message Is Too Big For VInputMessageStorage");
+		static_assert(std::is_trivially_destructible<_Message>::value &&
+			std::is_trivially_copyable<_Message>::value, "Input Messages Should Be Plain Data");
+
+		HasMessage = true;
+
+		return new (Buffer) _Message(std::forward<_Args>(Args)...);
+	}
+
+	/*
+	 * Get Functional:
+	 *	@description  : Get the Stored Message, nullptr If Empty
+	*/
+	VMessage* Get() {
+		return HasMessage == true ? reinterpret_cast<VMessage*>(Buffer) : nullptr;
+	}
+	/*
+	 * Clear Functional:
+	 *	@description  : Drop the Stored Message
+	*/
+	void Clear() {
+		HasMessage = false;
+	}
+};
+
 VLIB_END_NAMESPACE
@@ -0,0 +1,234 @@
+﻿/*
+ * VProfiler.hpp
+ *	@description : Scoped Timing Zones And Chrome Trace Export
+ *	@birth		 : 2022/7.16
+*/
+
+#pragma once
+
+#include "vbase.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VProfileEvent struct:
+ *	@description  : One Finished Zone ( Microseconds Since Profiler Start )
+*/
+struct VProfileEvent {
+	/* Sequence Is Written Last, A Slot Is Valid Only When It Matches the Write Position */
+	std::atomic<unsigned long long> Sequence;
+
+	const char*   Name;
+	const char*   Category;
+	char          Detail[48];
+
+	long long     Begin;
+	long long     Duration;
+	unsigned long ThreadID;
+};
+
+/*
+ * VProfiler class:
+ *	@description  : Collect Zones Into a Lock-free Ring Buffer ( Old Zones Are Overwritten ),
+ *					Any Thread Could Write, Dump Could Happen On Demand
+*/
+class VProfiler {
+public:
+	static const unsigned long long Capacity = 16384;
+
+private:
+	VProfileEvent                         Events[Capacity];
+	std::atomic<unsigned long long>       WritePosition;
+	std::atomic<bool>                     Enabled;
+
+	std::chrono::steady_clock::time_point Epoch;
+
+private:
+	VProfiler() : WritePosition(0), Enabled(true) {
+		Epoch = std::chrono::steady_clock::now();
+
+		for (auto& Event : Events) {
+			Event.Sequence.store(~0ull);
+		}
+	}
+
+	/*
+	 * WriteJsonString Functional:
+	 *	@description  : Write a Escaped Json String
+	*/
+	static void WriteJsonString(FILE* File, const char* String) {
+		fputc('"', File);
+
+		for (; *String != '\0'; ++String) {
+			if (*String == '"' || *String == '\\') {
+				fputc('\\', File);
+			}
+
+			fputc(static_cast<unsigned char>(*String) < 0x20 ? ' ' : *String, File);
+		}
+
+		fputc('"', File);
+	}
+
+public:
+	/*
+	 * Instance Functional:
+	 *	@description  : Get the Global Profiler
+	*/
+	static VProfiler& Instance() {
+		static VProfiler GlobalProfiler;
+
+		return GlobalProfiler;
+	}
+
+	/*
+	 * Now Functional:
+	 *	@description  : Microseconds Since the Profiler Started
+	*/
+	long long Now() const {
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - Epoch).count();
+	}
+
+	void SetEnable(bool Stats) {
+		Enabled.store(Stats, std::memory_order_relaxed);
+	}
+	bool IsEnable() const {
+		return Enabled.load(std::memory_order_relaxed);
+	}
+
+	/*
+	 * Push Functional:
+	 *	@description  : Write a Finished Zone Into the Ring Buffer
+	*/
+	void Push(const char* Name, const char* Category, const char* Detail, long long Begin, long long Duration) {
+		unsigned long long Position = WritePosition.fetch_add(1, std::memory_order_relaxed);
+		VProfileEvent&     Event    = Events[Position % Capacity];
+
+		Event.Sequence.store(~0ull, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		Event.Name     = Name;
+		Event.Category = Category;
+		Event.Begin    = Begin;
+		Event.Duration = Duration;
+		Event.ThreadID = GetCurrentThreadId();
+
+		size_t Length = 0;
+		for (; Detail != nullptr && Detail[Length] != '\0' && Length < sizeof(Event.Detail) - 1; ++Length) {
+			Event.Detail[Length] = Detail[Length];
+		}
+		Event.Detail[Length] = '\0';
+
+		Event.Sequence.store(Position, std::memory_order_release);
+	}
+
+	/*
+	 * DumpChromeTrace Functional:
+	 *	@description  : Dump the Buffered Zones As Chrome Trace-event Json ( chrome://tracing )
+	 *	@return value : Succeed Or Not
+	*/
+	bool DumpChromeTrace(std::wstring FilePath) {
+		FILE* File = _wfopen(FilePath.c_str(), L"w");
+
+		if (File == nullptr) {
+			return false;
+		}
+
+		unsigned long long End   = WritePosition.load(std::memory_order_acquire);
+		unsigned long long Start = End > Capacity ? End - Capacity : 0;
+
+		fputs("{\"traceEvents\":[", File);
+
+		bool FirstEvent = true;
+
+		for (unsigned long long Position = Start; Position < End; ++Position) {
+			VProfileEvent& Event = Events[Position % Capacity];
+
+			if (Event.Sequence.load(std::memory_order_acquire) != Position) {
+				continue;
+			}
+
+			const char*   Name     = Event.Name;
+			const char*   Category = Event.Category;
+			long long     Begin    = Event.Begin;
+			long long     Duration = Event.Duration;
+			unsigned long ThreadID = Event.ThreadID;
+			char          Detail[sizeof(Event.Detail)];
+
+			memcpy(Detail, Event.Detail, sizeof(Detail));
+			Detail[sizeof(Detail) - 1] = '\0';
+
+			/* The Slot Was Overwritten While Reading */
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (Event.Sequence.load(std::memory_order_relaxed) != Position) {
+				continue;
+			}
+
+			fputs(FirstEvent ? "\n" : ",\n", File);
+			FirstEvent = false;
+
+			fputs("{\"name\":", File);
+			WriteJsonString(File, Name);
+			fputs(",\"cat\":", File);
+			WriteJsonString(File, Category);
+			fprintf(File, ",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%lld,\"dur\":%lld,\"args\":{\"detail\":",
+				ThreadID, Begin, Duration);
+			WriteJsonString(File, Detail);
+			fputs("}}", File);
+		}
+
+		fputs("\n]}\n", File);
+		fclose(File);
+
+		return true;
+	}
+};
+
+/*
+ * VProfileZone class:
+ *	@description  : Time the Scope It Lives In
+*/
+class VProfileZone {
+private:
+	const char* Name;
+	const char* Category;
+	const char* Detail;
+
+	long long   Begin;
+
+public:
+	VProfileZone(const char* ZoneName, const char* ZoneCategory, const char* ZoneDetail = nullptr)
+		: Name(ZoneName), Category(ZoneCategory), Detail(ZoneDetail) {
+		Begin = VProfiler::Instance().IsEnable() ? VProfiler::Instance().Now() : -1;
+	}
+	~VProfileZone() {
+		if (Begin >= 0) {
+			VProfiler::Instance().Push(Name, Category, Detail, Begin, VProfiler::Instance().Now() - Begin);
+		}
+	}
+
+	VProfileZone(const VProfileZone&) = delete;
+	void operator=(const VProfileZone&) = delete;
+};
+
+/*
+ * VProfileScope Marco:
+ *		Time the Current Scope, Define "VLIB_DISABLE_PROFILER" To Compile Zones Out
+*/
+#define VPROFILE_JOIN_IMPL(A, B) A##B
+#define VPROFILE_JOIN(A, B)      VPROFILE_JOIN_IMPL(A, B)
+
+#ifndef VLIB_DISABLE_PROFILER
+#	define VProfileScope(Name, Category)          VProfileZone VPROFILE_JOIN(_VProfileZone, __LINE__)(Name, Category)
+#	define VProfileScopeEx(Name, Category, Detail) VProfileZone VPROFILE_JOIN(_VProfileZone, __LINE__)(Name, Category, Detail)
+#else
+#	define VProfileScope(Name, Category)
+#	define VProfileScopeEx(Name, Category, Detail)
+#endif
+
+VLIB_END_NAMESPACE
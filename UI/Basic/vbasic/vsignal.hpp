@@ -5,197 +5,283 @@
 #pragma once
 
 #include "vbase.hpp"
+#include "vhandle.hpp"
+#include "vmailbox.hpp"
 
-#include <functional>
-#include <memory>
-#include <list>
+#include <cstring>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 VLIB_BEGIN_NAMESPACE
-template<class... Type>
-class connect_basic {
-private:
-	std::function<void(Type...)> call_function;
-	bool                         be_blocked = false;
 
-public:
-	connect_basic(std::function<void(Type...)> function) {
-		call_function = function;
-	}
-	inline std::function<void(Type...)>* get_function() {
-		return &call_function;
-	}
+/*
+ * The largest member function pointer we keep inline
+ * (MSVC uses up to 16 bytes for unknown inheritance, plus padding)
+*/
+const size_t signal_slot_storage = 2 * sizeof(void*) + 2 * sizeof(int);
 
-	bool is_block() {
-		return be_blocked;
-	}
-	void set_block(bool stats) {
-		be_blocked = stats;
-	}
-};
 template<class... Type>
-class connect_functional : public connect_basic<Type...> {
-public:
+class VSignal {
+private:
+	/*
+	 * slot: a inline delegate, the target is copied into storage (no heap, no std::function)
+	 * invoker also tells the target type, so two slots are the same only when
+	 * invoker, object and storage all match
+	*/
+	struct slot {
+		using invoker_ptr = void(*)(const slot&, Type...);
+
+		invoker_ptr   invoker;
+		void*         object;
+		unsigned char storage[signal_slot_storage];
+
+		bool          blocked;
+		bool          removed;
+		/* queued slots are called later on the ui thread, from its mailbox */
+		bool          queued;
+
+		/* queued member slots resolve the receiver's handle before the call, it may be deleted by then */
+		VObjectHandle receiver;
+		bool (*alive)(const slot&);
+
+		bool same_target(const slot& target) const {
+			return invoker == target.invoker && object == target.object &&
+				memcmp(storage, target.storage, signal_slot_storage) == 0;
+		}
+	};
+
 	using functional_ptr = void(*)(Type...);
 
-private:
-	functional_ptr functional;
+	/*
+	 * queued_call: a emit waiting in the ui mailbox, the arguments are stored by value
+	 * (a receiver deleted before the mailbox drains is skipped)
+	*/
+	class queued_call : public VMailboxTask {
+	private:
+		slot                                             target;
+		std::tuple<typename std::decay<Type>::type...> arguments;
+
+	private:
+		template<size_t... Index>
+		void invoke(std::index_sequence<Index...>) {
+			target.invoker(target, std::forward<Type>(std::get<Index>(arguments))...);
+		}
 
-public:
-	connect_functional(functional_ptr init_function)
-		: connect_basic<Type...>(std::function<void(Type...)>(init_function)) {
-		functional = init_function;
-	}
+	public:
+		queued_call(const slot& queued_target, Type... args)
+			: target(queued_target), arguments(args...) {
+		}
 
-	inline functional_ptr get_raw_function() {
-		return functional;
-	}
-};
+		void Run() override {
+			if (target.alive != nullptr && target.alive(target) == false) {
+				return;
+			}
 
-template<class ObjectType, class... Type>
-class connection : public connect_basic<Type ...> {
-public:
-	using object_functional_ptr = void (ObjectType::*)(Type ...);
+			invoke(std::index_sequence_for<Type...>());
+		}
+	};
 
 private:
-	ObjectType* object_ref;
-	object_functional_ptr object_functional;
+	std::vector<slot> slots;
 
-public:
-	connection(ObjectType* object, object_functional_ptr functional)
-		: connect_basic<Type...>([object, functional](Type... args) { (*object.*functional)(args...); }) {
-		object_ref = object;
-		object_functional = functional;
+	/* emit may nest (a slot emits the same signal), removed slots are compacted by the outermost one */
+	int               emit_depth  = 0;
+	bool              has_removed = false;
+
+	/*
+	 * guards slots, emit_depth and has_removed: worker threads emit while the ui thread
+	 * connects and disconnects, the lock is never held while a slot runs
+	*/
+	std::mutex        slots_lock;
+
+private:
+	static void function_invoker(const slot& target, Type... args) {
+		functional_ptr functional;
+		memcpy(&functional, target.storage, sizeof(functional));
+
+		functional(std::forward<Type>(args)...);
 	}
+	template<class ObjectType>
+	static void member_invoker(const slot& target, Type... args) {
+		void (ObjectType::* functional)(Type...);
+		memcpy(&functional, target.storage, sizeof(functional));
 
-	inline void* get_raw_object() {
-		return object_ref;
+		(static_cast<ObjectType*>(target.object)->*functional)(std::forward<Type>(args)...);
 	}
-	inline object_functional_ptr
-		get_raw_call() {
-		return object_functional;
+	template<class ObjectType>
+	static bool receiver_alive(const slot& target) {
+		return ObjectType::FromHandle(target.receiver) == static_cast<ObjectType*>(target.object);
 	}
-};
 
-template<class... Type>
-class VSignal {
-private:
-	std::list<std::shared_ptr<connect_basic<Type...> > >
-		slots;
+	static slot make_slot(void (*functional)(Type...)) {
+		slot target = {};
 
-private:
-	void _operator(void (*functional)(Type...), int operator_stage) {
-		for (auto iterator = slots.begin(); iterator != slots.end();) {
-			connect_functional<Type...>* connect_function = static_cast<connect_functional<Type...>*>((*iterator).get());
+		target.invoker = &function_invoker;
+		target.object  = nullptr;
+		memcpy(target.storage, &functional, sizeof(functional));
 
-			if (connect_function->get_raw_function() == functional) {
-				switch (operator_stage) {
-				case 0: {
-					slots.erase(iterator++);
+		return target;
+	}
+	template<class ObjectType>
+	static slot make_slot(ObjectType* object, void (ObjectType::* functional)(Type...)) {
+		static_assert(sizeof(functional) <= signal_slot_storage, "member function pointer is too big for a signal slot");
 
-					break;
-				}
-				case 1: {
-					connect_function->set_block(true);
+		slot target = {};
 
-					++iterator;
+		target.invoker = &member_invoker<ObjectType>;
+		target.object  = object;
+		memcpy(target.storage, &functional, sizeof(functional));
 
-					break;
-				}
-				case 2: {
-					connect_function->set_block(false);
+		return target;
+	}
 
-					++iterator;
+	/*
+	 * _operator: 0 = disconnect, 1 = block, 2 = unblock
+	*/
+	void _operator(const slot& target, int operator_stage) {
+		std::lock_guard<std::mutex> lock(slots_lock);
 
-					break;
-				}
-				}
-			}
-			else
-			{
-				++iterator;
-			}
-		}
-	}
-	template<class ObjectType>
-	void _operator(ObjectType* object, void (ObjectType::* object_function)(Type...), int opreator_stage) {
-		for (auto iterator = slots.begin(); iterator != slots.end(); ) {
-			if (iterator->get()->is_block() == true) {
+		for (auto& connected : slots) {
+			if (connected.removed == true || connected.same_target(target) == false) {
 				continue;
 			}
 
-			connection<ObjectType, Type...>* connect = static_cast<connection<ObjectType, Type...>*>((*iterator).get());
+			switch (operator_stage) {
+			case 0: {
+				connected.removed = true;
+				has_removed       = true;
 
-			if (connect->get_raw_call() == object_function &&
-				connect->get_raw_object() == object) {
-				switch (opreator_stage) {
-				case 0: {
-					slots.erase(iterator++);
+				break;
+			}
+			case 1: {
+				connected.blocked = true;
 
-					break;
-				}
-				case 1: {
-					connect->set_block(true);
+				break;
+			}
+			case 2: {
+				connected.blocked = false;
 
-					++iterator;
+				break;
+			}
+			}
+		}
 
-					break;
-				}
-				case 2: {
-					connect->set_block(false);
+		if (emit_depth == 0) {
+			compact();
+		}
+	}
 
-					++iterator;
+	void compact() {
+		if (has_removed == false) {
+			return;
+		}
 
-					break;
-				}
-				}
-			}
-			else
-			{
-				++iterator;
+		size_t keep = 0;
+
+		for (size_t count = 0; count < slots.size(); ++count) {
+			if (slots[count].removed == false) {
+				slots[keep++] = slots[count];
 			}
 		}
+
+		slots.resize(keep);
+
+		has_removed = false;
+	}
+
+	void add_slot(const slot& target) {
+		std::lock_guard<std::mutex> lock(slots_lock);
+
+		slots.push_back(target);
 	}
 
 public:
 	inline void Connect(void (*functional)(Type...)) {
-		std::shared_ptr<connect_functional<Type...>> functional_ptr
-		(new connect_functional<Type...>(functional));
-		slots.push_back(functional_ptr);
+		add_slot(make_slot(functional));
 	}
 	template<class ObjectType>
 	inline void Connect(ObjectType* object, void (ObjectType::* functional)(Type...)) {
-		std::shared_ptr<connection<ObjectType, Type...> > functional_ptr
-		(new connection<ObjectType, Type...>(object, functional));
+		add_slot(make_slot(object, functional));
+	}
 
-		slots.push_back(functional_ptr);
+	/*
+	 * ConnectQueued: the slot is not called by emit, it is posted to the ui mailbox
+	 * and called when the ui thread drains it (use it to report from worker threads),
+	 * the receiver needs GetHandle / FromHandle (a VUIObject) so a deleted one is skipped
+	*/
+	inline void ConnectQueued(void (*functional)(Type...)) {
+		slot target = make_slot(functional);
+		target.queued = true;
+
+		add_slot(target);
+	}
+	template<class ObjectType>
+	inline void ConnectQueued(ObjectType* object, void (ObjectType::* functional)(Type...)) {
+		slot target = make_slot(object, functional);
+		target.queued   = true;
+		target.receiver = object->GetHandle();
+		target.alive    = &receiver_alive<ObjectType>;
+
+		add_slot(target);
 	}
 
 	inline void Disconnect(void (*functional)(Type...)) {
-		_operator(functional, 0);
+		_operator(make_slot(functional), 0);
 	}
 	template<class ObjectType>
 	inline void Disconnect(ObjectType* object, void (ObjectType::* functional)(Type...)) {
-		_operator(object, functional, 0);
+		_operator(make_slot(object, functional), 0);
 	}
 
 	void Block(void (*functional)(Type ...), bool block_stats) {
-		_operator(functional, block_stats ? 1 : 2);
+		_operator(make_slot(functional), block_stats ? 1 : 2);
 	}
 	template<class ObjectType>
 	void Block(ObjectType* object, void (ObjectType::* functional)(Type ...), bool block_stats) {
-		_operator(object, functional, block_stats ? 1 : 2);
+		_operator(make_slot(object, functional), block_stats ? 1 : 2);
 	}
 
+	/*
+	 * Emit: slots connected while emitting are called from the next emit,
+	 * slots disconnected while emitting are not called any more,
+	 * queued slots only post a call. Emit may run on any thread, direct slots
+	 * run on the emitting thread (connect queued to get back to the ui thread)
+	*/
 	void Emit(Type... args) {
-		for (auto iterator = slots.begin(); iterator != slots.end(); ++iterator) {
-			if (iterator->get()->is_block() == true) {
+		std::unique_lock<std::mutex> lock(slots_lock);
+
+		/* compaction waits for emit_depth 0, so the indices stay valid while the lock is dropped */
+		const size_t slot_count = slots.size();
+
+		++emit_depth;
+
+		for (size_t count = 0; count < slot_count; ++count) {
+			/* copy, a slot may connect and grow the vector */
+			const slot target = slots[count];
+
+			if (target.blocked == true || target.removed == true) {
 				continue;
 			}
 
-			auto call_function = iterator->get()->get_function();
+			if (target.queued == true) {
+				_VL_UI_Mailbox.Post(new queued_call(target, args...));
+
+				continue;
+			}
+
+			lock.unlock();
+
+			target.invoker(target, args...);
+
+			lock.lock();
+		}
 
-			(*call_function)(args...);
+		if (--emit_depth == 0) {
+			compact();
 		}
 	}
 };
-VLIB_END_NAMESPACE
\ No newline at end of file
+VLIB_END_NAMESPACE
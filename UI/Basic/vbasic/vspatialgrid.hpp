@@ -0,0 +1,222 @@
+﻿/*
+ * VSpatialGrid.hpp
+ *	@description : A Uniform Grid Index Of Rectangles For Hit Testing
+ *	@birth		 : 2022/7.17
+*/
+
+#pragma once
+
+#include "vbase.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VSpatialGrid class:
+ *	@description  : Bucket Objects Into Fixed Size Cells By Their Rectangles ( Edges Inclusive ),
+ *					a Point Query Only Visits the Objects Registered In One Cell. Objects Covering
+ *					More Than MaxLinkedCells Cells ( a Zoomed Image ) Are Kept In a Oversized List
+ *					Scanned By Every Query, So Moving Them Never Rebuilds Cells
+*/
+template<class _Type>
+class VSpatialGrid {
+private:
+	struct VGridEntry {
+		VRect Rect;
+
+		int   CellLeft;
+		int   CellTop;
+		int   CellRight;
+		int   CellBottom;
+
+		bool  Oversized;
+	};
+
+	/* Cells a Object May Be Linked Into, Bigger Objects Go To the Oversized List */
+	static const long long MaxLinkedCells = 64;
+
+	std::unordered_map<long long, std::vector<_Type*>> Cells;
+	std::unordered_map<_Type*, VGridEntry>             Entries;
+	std::vector<_Type*>                                OversizedObjects;
+
+	int                                                CellSize;
+
+private:
+	/*
+	 * CellOf Functional:
+	 *	@description  : Get the Cell Coordinate Of a Position ( Floor Division, Works For Negative Positions )
+	*/
+	int CellOf(int Position) const {
+		return Position >= 0 ? Position / CellSize : -((-Position + CellSize - 1) / CellSize);
+	}
+	static long long CellKey(int CellX, int CellY) {
+		return (static_cast<long long>(CellX) << 32) ^ static_cast<unsigned int>(CellY);
+	}
+
+	void LinkEntry(_Type* Object, const VGridEntry& Entry) {
+		if (Entry.Oversized == true) {
+			OversizedObjects.push_back(Object);
+
+			return;
+		}
+
+		for (int CellY = Entry.CellTop; CellY <= Entry.CellBottom; ++CellY) {
+			for (int CellX = Entry.CellLeft; CellX <= Entry.CellRight; ++CellX) {
+				Cells[CellKey(CellX, CellY)].push_back(Object);
+			}
+		}
+	}
+	void UnlinkEntry(_Type* Object, const VGridEntry& Entry) {
+		if (Entry.Oversized == true) {
+			for (size_t Count = 0; Count < OversizedObjects.size(); ++Count) {
+				if (OversizedObjects[Count] == Object) {
+					OversizedObjects[Count] = OversizedObjects.back();
+					OversizedObjects.pop_back();
+
+					break;
+				}
+			}
+
+			return;
+		}
+
+		for (int CellY = Entry.CellTop; CellY <= Entry.CellBottom; ++CellY) {
+			for (int CellX = Entry.CellLeft; CellX <= Entry.CellRight; ++CellX) {
+				auto Cell = Cells.find(CellKey(CellX, CellY));
+
+				if (Cell == Cells.end()) {
+					continue;
+				}
+
+				auto& CellObjects = Cell->second;
+
+				for (size_t Count = 0; Count < CellObjects.size(); ++Count) {
+					if (CellObjects[Count] == Object) {
+						CellObjects[Count] = CellObjects.back();
+						CellObjects.pop_back();
+
+						break;
+					}
+				}
+
+				if (CellObjects.empty() == true) {
+					Cells.erase(Cell);
+				}
+			}
+		}
+	}
+
+	VGridEntry MakeEntry(VRect Rect) const {
+		VGridEntry Entry;
+
+		Entry.Rect       = Rect;
+		Entry.CellLeft   = CellOf(Rect.left);
+		Entry.CellTop    = CellOf(Rect.top);
+		Entry.CellRight  = CellOf(Rect.right);
+		Entry.CellBottom = CellOf(Rect.bottom);
+
+		Entry.Oversized  = static_cast<long long>(Entry.CellRight - Entry.CellLeft + 1) *
+			static_cast<long long>(Entry.CellBottom - Entry.CellTop + 1) > MaxLinkedCells;
+
+		return Entry;
+	}
+
+public:
+	/*
+	 * Build up Functional
+	*/
+
+	explicit VSpatialGrid(int GridCellSize = 64) : CellSize(GridCellSize > 0 ? GridCellSize : 64) {
+
+	}
+
+	/*
+	 * Insert Functional:
+	 *	@description  : Insert Or Move a Object To the Rect
+	*/
+	void Insert(_Type* Object, VRect Rect) {
+		VGridEntry NewEntry = MakeEntry(Rect);
+		auto       Entry    = Entries.find(Object);
+
+		if (Entry != Entries.end()) {
+			/* Still In the Same Cells ( Or Still Oversized ), Only Record the New Rect */
+			if ((Entry->second.Oversized == true && NewEntry.Oversized == true) ||
+				(Entry->second.Oversized == false && NewEntry.Oversized == false &&
+				Entry->second.CellLeft == NewEntry.CellLeft && Entry->second.CellTop == NewEntry.CellTop &&
+				Entry->second.CellRight == NewEntry.CellRight && Entry->second.CellBottom == NewEntry.CellBottom)) {
+				Entry->second = NewEntry;
+
+				return;
+			}
+
+			UnlinkEntry(Object, Entry->second);
+
+			Entry->second = NewEntry;
+		}
+		else {
+			Entries.insert(std::make_pair(Object, NewEntry));
+		}
+
+		LinkEntry(Object, NewEntry);
+	}
+	/*
+	 * Remove Functional:
+	 *	@description  : Remove a Object From the Grid
+	*/
+	void Remove(_Type* Object) {
+		auto Entry = Entries.find(Object);
+
+		if (Entry == Entries.end()) {
+			return;
+		}
+
+		UnlinkEntry(Object, Entry->second);
+
+		Entries.erase(Entry);
+	}
+	/*
+	 * Contains Functional:
+	 *	@description  : Is the Object In the Grid
+	*/
+	bool Contains(_Type* Object) const {
+		return Entries.find(Object) != Entries.end();
+	}
+
+	/*
+	 * Query Functional:
+	 *	@description  : Append the Objects Whose Rect Contains the Point ( Unordered )
+	*/
+	void Query(VPoint Point, std::vector<_Type*>& Result) const {
+		for (auto Object : OversizedObjects) {
+			if (Point.InsideRect(Entries.find(Object)->second.Rect) == true) {
+				Result.push_back(Object);
+			}
+		}
+
+		auto Cell = Cells.find(CellKey(CellOf(Point.x), CellOf(Point.y)));
+
+		if (Cell == Cells.end()) {
+			return;
+		}
+
+		for (auto Object : Cell->second) {
+			if (Point.InsideRect(Entries.find(Object)->second.Rect) == true) {
+				Result.push_back(Object);
+			}
+		}
+	}
+
+	/*
+	 * Clear Functional:
+	 *	@description  : Remove Every Object
+	*/
+	void Clear() {
+		Cells.clear();
+		Entries.clear();
+		OversizedObjects.clear();
+	}
+};
+
+VLIB_END_NAMESPACE
@@ -0,0 +1,200 @@
+﻿/*
+ * VTaskQueue.hpp
+ *	@description : Cooperative Jobs On the UI Thread, Run In Slices Under a Frame Budget
+ *	@birth		 : 2022/7.20
+*/
+
+#pragma once
+
+#include "vbase.hpp"
+#include "vclock.hpp"
+
+#include <functional>
+#include <vector>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VTaskHandle struct:
+ *	@description  : Names a Posted Job, 0 Means None
+*/
+struct VTaskHandle {
+	unsigned long long Id = 0;
+};
+
+/*
+ * VTaskQueue class:
+ *	@description  : Each Job Is a Slice Functional Which Does a Small Piece Of Work And Returns
+ *					Whether There Is More, Slices Of the Jobs Run In Turn Until the Budget Is Used Up
+*/
+class VTaskQueue {
+private:
+	struct Task {
+		unsigned long long    Id;
+		std::function<bool()> Slice;
+
+		bool                  Finished;
+	};
+
+private:
+	std::vector<Task>  Tasks;
+	/* Jobs Posted While Running, Joined After the Run */
+	std::vector<Task>  PendingTasks;
+
+	unsigned long long NextId    = 1;
+	size_t             NextTask  = 0;
+	long long          Budget    = 4000;
+	bool               Running   = false;
+
+private:
+	/*
+	 * Compact Functional:
+	 *	@description  : Drop the Finished Jobs And Join the Pending Ones
+	*/
+	void Compact() {
+		/* The Turn Stays With the Same Job, Counted Among the Kept Ones */
+		size_t Keep    = 0;
+		size_t NewNext = 0;
+
+		for (size_t Count = 0; Count < Tasks.size(); ++Count) {
+			if (Count == NextTask) {
+				NewNext = Keep;
+			}
+			if (Tasks[Count].Finished == false) {
+				if (Keep != Count) {
+					Tasks[Keep] = std::move(Tasks[Count]);
+				}
+
+				++Keep;
+			}
+		}
+
+		Tasks.resize(Keep);
+
+		NextTask = NewNext < Tasks.size() ? NewNext : 0;
+
+		for (auto& Pending : PendingTasks) {
+			if (Pending.Finished == false) {
+				Tasks.push_back(std::move(Pending));
+			}
+		}
+
+		PendingTasks.clear();
+	}
+
+public:
+	/*
+	 * Post Functional:
+	 *	@description  : Queue a Job, the Slice Is Called Until It Returns false ( UI Thread Only )
+	*/
+	VTaskHandle Post(std::function<bool()> Slice) {
+		VTaskHandle Handle;
+		Handle.Id = NextId++;
+
+		Task NewTask = { Handle.Id, std::move(Slice), false };
+
+		if (Running == true) {
+			PendingTasks.push_back(std::move(NewTask));
+		}
+		else {
+			Tasks.push_back(std::move(NewTask));
+		}
+
+		return Handle;
+	}
+	/*
+	 * Cancel Functional:
+	 *	@description  : Drop a Job Before It Finishes ( Also From Inside a Slice ), the Handle Is Cleared
+	*/
+	void Cancel(VTaskHandle& Handle) {
+		for (auto& Queued : Tasks) {
+			if (Queued.Id == Handle.Id) {
+				Queued.Finished = true;
+			}
+		}
+		for (auto& Queued : PendingTasks) {
+			if (Queued.Id == Handle.Id) {
+				Queued.Finished = true;
+			}
+		}
+
+		if (Running == false) {
+			Compact();
+		}
+
+		Handle = VTaskHandle();
+	}
+
+	/*
+	 * IsEmpty Functional:
+	 *	@description  : Is No Job Waiting
+	*/
+	bool IsEmpty() const {
+		return Tasks.empty() == true && PendingTasks.empty() == true;
+	}
+
+	/*
+	 * SetBudget Functional:
+	 *	@description  : Set How Long the Jobs May Run Each Frame ( Microseconds )
+	*/
+	void SetBudget(long long NewBudget) {
+		Budget = NewBudget > 0 ? NewBudget : 0;
+	}
+	long long GetBudget() const {
+		return Budget;
+	}
+
+	/*
+	 * Run Functional:
+	 *	@description  : Run Slices In Turn Until the Budget Is Used Up Or Every Job Finished,
+	 *					At Least One Slice Runs So Jobs Always Move On
+	 *	@return value : How Many Slices Ran
+	*/
+	size_t Run() {
+		if (Tasks.empty() == true) {
+			Compact();
+
+			return 0;
+		}
+
+		long long StartTime  = VClock::Instance().Now();
+		size_t    SliceCount = 0;
+
+		Running = true;
+
+		do {
+			/* Find the Next Unfinished Job In Turn */
+			size_t Position = Tasks.size();
+
+			for (size_t Count = 0; Count < Tasks.size(); ++Count) {
+				size_t Candidate = (NextTask + Count) % Tasks.size();
+
+				if (Tasks[Candidate].Finished == false) {
+					Position = Candidate;
+
+					break;
+				}
+			}
+
+			if (Position == Tasks.size()) {
+				break;
+			}
+
+			if (Tasks[Position].Slice() == false) {
+				Tasks[Position].Finished = true;
+			}
+
+			NextTask = (Position + 1) % Tasks.size();
+
+			++SliceCount;
+		} while (VClock::Instance().Now() - StartTime < Budget);
+
+		Running = false;
+
+		Compact();
+
+		return SliceCount;
+	}
+};
+
+VLIB_END_NAMESPACE
@@ -0,0 +1,208 @@
+﻿/*
+ * VThreadPool.hpp
+ *	@description : A Simple Worker Pool For Data-Parallel Jobs
+ *	@birth		 : 2022/7.14
+*/
+
+#pragma once
+
+#include "vbase.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VThreadPool class:
+ *	@description  : A Fixed Worker Pool, Each Job Is Split Into Independent Tasks By Index
+*/
+class VThreadPool {
+private:
+	std::vector<std::thread>          Workers;
+
+	std::mutex                        PoolLock;
+	std::mutex                        JobLock;
+	std::condition_variable           JobCondition;
+	std::condition_variable           DoneCondition;
+
+	const std::function<void(size_t)>* JobFunction = nullptr;
+	size_t                            JobTaskCount = 0;
+	std::atomic<size_t>               JobNextTask;
+	size_t                            JobFinishedTask = 0;
+	size_t                            JobActiveWorker = 0;
+	unsigned long long                JobGeneration = 0;
+
+	bool                              ExitFlag = false;
+
+private:
+	/*
+	 * InWorkerThread Functional:
+	 *	@description  : Is the Caller One Of the Pool Workers ( Nested Jobs Run Inline )
+	*/
+	static bool& InWorkerThread() {
+		thread_local bool WorkerFlag = false;
+
+		return WorkerFlag;
+	}
+
+	/*
+	 * RunTasks Functional:
+	 *	@description  : Take Tasks Until the Job Is Drained
+	 *	@return value : How Many Tasks This Thread Finished
+	*/
+	size_t RunTasks(const std::function<void(size_t)>* Function, size_t TaskCount) {
+		size_t FinishedCount = 0;
+
+		for (size_t Task = JobNextTask.fetch_add(1); Task < TaskCount; Task = JobNextTask.fetch_add(1)) {
+			(*Function)(Task);
+
+			++FinishedCount;
+		}
+
+		return FinishedCount;
+	}
+
+	/*
+	 * WorkerLoop Functional:
+	 *	@description  : The Worker Thread Body
+	*/
+	void WorkerLoop() {
+		InWorkerThread() = true;
+
+		unsigned long long LocalGeneration = 0;
+
+		while (true) {
+			const std::function<void(size_t)>* Function = nullptr;
+			size_t                             TaskCount = 0;
+
+			{
+				std::unique_lock<std::mutex> Lock(JobLock);
+
+				JobCondition.wait(Lock, [&]() { return ExitFlag == true || JobGeneration != LocalGeneration; });
+
+				if (ExitFlag == true) {
+					return;
+				}
+
+				LocalGeneration = JobGeneration;
+				Function        = JobFunction;
+				TaskCount       = JobTaskCount;
+
+				/* Woke Up After the Job Already Finished */
+				if (Function == nullptr) {
+					continue;
+				}
+
+				++JobActiveWorker;
+			}
+
+			size_t FinishedCount = RunTasks(Function, TaskCount);
+
+			{
+				std::lock_guard<std::mutex> Lock(JobLock);
+
+				JobFinishedTask += FinishedCount;
+				--JobActiveWorker;
+			}
+
+			DoneCondition.notify_one();
+		}
+	}
+
+public:
+	/*
+	 * Build up & Deleter Functional
+	*/
+
+	explicit VThreadPool(size_t WorkerCount) : JobNextTask(0) {
+		for (size_t Count = 0; Count < WorkerCount; ++Count) {
+			Workers.emplace_back(&VThreadPool::WorkerLoop, this);
+		}
+	}
+	~VThreadPool() {
+		{
+			std::lock_guard<std::mutex> Lock(JobLock);
+
+			ExitFlag = true;
+		}
+
+		JobCondition.notify_all();
+
+		for (auto& Worker : Workers) {
+			Worker.join();
+		}
+	}
+
+	VThreadPool(const VThreadPool&) = delete;
+	void operator=(const VThreadPool&) = delete;
+
+	/*
+	 * Instance Functional:
+	 *	@description  : Get the Shared Pool ( One Worker Per Extra Core )
+	*/
+	static VThreadPool& Instance() {
+		static VThreadPool SharedPool(std::thread::hardware_concurrency() > 1 ?
+			std::thread::hardware_concurrency() - 1 : 0);
+
+		return SharedPool;
+	}
+
+	/*
+	 * GetConcurrency Functional:
+	 *	@description  : How Many Threads Run a Job ( Workers And the Caller )
+	*/
+	size_t GetConcurrency() const {
+		return Workers.size() + 1;
+	}
+
+	/*
+	 * ParallelFor Functional:
+	 *	@description  : Run Function(0 ... TaskCount - 1) On the Pool, the Caller Takes Part Too,
+	 *					Return After Every Task Finished
+	*/
+	void ParallelFor(size_t TaskCount, const std::function<void(size_t)>& Function) {
+		if (TaskCount == 0) {
+			return;
+		}
+		if (TaskCount == 1 || Workers.empty() == true || InWorkerThread() == true) {
+			for (size_t Task = 0; Task < TaskCount; ++Task) {
+				Function(Task);
+			}
+
+			return;
+		}
+
+		std::lock_guard<std::mutex> PoolGuard(PoolLock);
+
+		{
+			std::lock_guard<std::mutex> Lock(JobLock);
+
+			JobFunction     = &Function;
+			JobTaskCount    = TaskCount;
+			JobFinishedTask = 0;
+			JobNextTask.store(0);
+
+			++JobGeneration;
+		}
+
+		JobCondition.notify_all();
+
+		size_t FinishedCount = RunTasks(&Function, TaskCount);
+
+		std::unique_lock<std::mutex> Lock(JobLock);
+
+		JobFinishedTask += FinishedCount;
+
+		/* Wait Until Every Task Done And No Worker Still Reads This Job */
+		DoneCondition.wait(Lock, [&]() { return JobFinishedTask == JobTaskCount && JobActiveWorker == 0; });
+
+		JobFunction = nullptr;
+	}
+};
+
+VLIB_END_NAMESPACE
@@ -7,20 +7,20 @@
 #pragma once
 
 #include "vbase.hpp"
+#include "vclock.hpp"
 #include "../../control/basic/VBasicControl/vapplication.hpp"
 
-#include <time.h>
-
 VLIB_BEGIN_NAMESPACE
 
 /*
  * VTimer class:
- *	@description  : The Basic Timer
+ *	@description  : The Basic Timer, Measured On the Frame Time Of VClock ( All Timers
+ *					Checked In One Frame Agree On the Time )
 */
 class VTimer {
 private:
-	time_t        ClockTimer;
-	unsigned long Duraction;
+	long long ClockTimer;
+	long long Duraction;
 
 public:
 	/*
@@ -34,29 +34,38 @@ public:
 
 	/*
 	 * Start Functional:
-	 *	@description  : Start Clock
+	 *	@description  : Start Clock ( Milliseconds )
 	*/
 	virtual void Start(unsigned long TimerDuraction) {
-		ClockTimer = clock();
+		ClockTimer = VClock::Instance().FrameTime();
 
-		Duraction  = TimerDuraction;
+		Duraction  = static_cast<long long>(TimerDuraction) * 1000;
 	}
 	/*
 	 * End Functional:
 	 *	@description  : Timer End
 	*/
 	bool End() {
-		return (clock() - ClockTimer >= Duraction);
+		return (VClock::Instance().FrameTime() - ClockTimer >= Duraction);
+	}
+	/*
+	 * GetRestTime Functional:
+	 *	@description  : How Long Until the Timer Ends ( Microseconds, 0 If Ended )
+	*/
+	long long GetRestTime() {
+		long long Rest = Duraction - (VClock::Instance().FrameTime() - ClockTimer);
+
+		return Rest > 0 ? Rest : 0;
 	}
 };
 
 /*
  * VSmartTimer class:
- *	@description  : A Timer Own Signal
+ *	@description  : A Timer Own Signal, Scheduled On the Application's Timer Wheel ( Never Polled )
 */
 class VSmartTimer : public VTimer, public VUIObject {
 private:
-	bool ClockStart = false;
+	VTimerHandle TimerHandle;
 
 public:
 	VSignal<> TimerOnTime;
@@ -65,21 +74,25 @@ public:
 	VSmartTimer(VApplication* Parent) : VUIObject(Parent) {
 
 	}
+	~VSmartTimer() override {
+		Stop();
+	}
 
 public:
 	void Start(unsigned long TimerDuraction) override {
 		VTimer::Start(TimerDuraction);
 
-		ClockStart = true;
+		VCoreApplication::Instance()->GetTimerWheel()->Debounce(TimerHandle, TimerDuraction, [this]() {
+			TimerOnTime.Emit();
+		});
 	}
-
-	void CheckFrame() override {
-		if (ClockStart == true) {
-			if (End() == true) {
-				ClockStart = false;
-
-				TimerOnTime.Emit();
-			}
+	/*
+	 * Stop Functional:
+	 *	@description  : Stop the Timer Before It Emits
+	*/
+	void Stop() {
+		if (VCoreApplication::Instance() != nullptr) {
+			VCoreApplication::Instance()->GetTimerWheel()->Cancel(TimerHandle);
 		}
 	}
 };
@@ -0,0 +1,352 @@
+﻿/*
+ * VTimerWheel.hpp
+ *	@description : A Hashed Hierarchical Timer Wheel For Timeouts And Debounces
+ *	@birth		 : 2022/7.20
+*/
+
+#pragma once
+
+#include "vbase.hpp"
+#include "vclock.hpp"
+
+#include <climits>
+#include <functional>
+#include <vector>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VTimerHandle struct:
+ *	@description  : Names a Scheduled Timer, Stale Handles ( Fired Or Cancelled ) Are Ignored
+*/
+struct VTimerHandle {
+	unsigned int Index      = 0xFFFFFFFFu;
+	unsigned int Generation = 0;
+};
+
+/*
+ * VTimerWheel class:
+ *	@description  : Four Levels Of 64 Slots On 1 ms Ticks ( About 4.6 Hours Before Clamping ),
+ *					Schedule And Cancel Are O(1), Advance Fires Every Expired Timer In One Pass
+*/
+class VTimerWheel {
+private:
+	static const int       SlotBits  = 6;
+	static const int       SlotCount = 1 << SlotBits;
+	static const int       SlotMask  = SlotCount - 1;
+	static const int       LevelCount = 4;
+
+	/* Microseconds Per Tick */
+	static const long long TickLength = 1000;
+
+	struct TimerNode {
+		std::function<void()> Callback;
+
+		long long             Expires    = 0;
+		unsigned int          Generation = 0;
+
+		/* Intrusive Slot List, -1 Ends It, Slot Is -1 When the Node Is Not Scheduled */
+		int                   Prev = -1;
+		int                   Next = -1;
+		int                   Slot = -1;
+	};
+
+private:
+	std::vector<TimerNode> Nodes;
+	std::vector<int>       FreeNodes;
+
+	int                    Heads[LevelCount * SlotCount];
+
+	/* The Next Tick To Be Processed */
+	long long              CurrentTick;
+	size_t                 ScheduledCount = 0;
+	bool                   Firing         = false;
+
+private:
+	/*
+	 * LinkNode Functional:
+	 *	@description  : Put a Node Into the Slot For Its Expire Tick ( Relative To CurrentTick )
+	*/
+	void LinkNode(int Index) {
+		TimerNode& Node = Nodes[Index];
+
+		/* Timers Added While Firing a Tick Wait For the Next One */
+		long long Earliest = Firing == true ? CurrentTick + 1 : CurrentTick;
+		long long Expires  = Node.Expires > Earliest ? Node.Expires : Earliest;
+		long long Delta    = Expires - CurrentTick;
+
+		int Level = 0;
+
+		while (Level < LevelCount - 1 && Delta >= (1ll << (SlotBits * (Level + 1)))) {
+			++Level;
+		}
+
+		/* Too Far Away, Park It At the End Of the Last Level And Place It Again When Cascaded */
+		if (Delta >= (1ll << (SlotBits * LevelCount))) {
+			Expires = CurrentTick + (1ll << (SlotBits * LevelCount)) - 1;
+		}
+
+		int Slot = Level * SlotCount + static_cast<int>((Expires >> (SlotBits * Level)) & SlotMask);
+
+		Node.Slot = Slot;
+		Node.Prev = -1;
+		Node.Next = Heads[Slot];
+
+		if (Heads[Slot] != -1) {
+			Nodes[Heads[Slot]].Prev = Index;
+		}
+
+		Heads[Slot] = Index;
+	}
+	/*
+	 * UnlinkNode Functional:
+	 *	@description  : Take a Node Out Of Its Slot
+	*/
+	void UnlinkNode(int Index) {
+		TimerNode& Node = Nodes[Index];
+
+		if (Node.Prev != -1) {
+			Nodes[Node.Prev].Next = Node.Next;
+		}
+		else {
+			Heads[Node.Slot] = Node.Next;
+		}
+		if (Node.Next != -1) {
+			Nodes[Node.Next].Prev = Node.Prev;
+		}
+
+		Node.Prev = -1;
+		Node.Next = -1;
+		Node.Slot = -1;
+	}
+	/*
+	 * ReleaseNode Functional:
+	 *	@description  : Return a Node To the Pool, Old Handles Become Stale
+	*/
+	void ReleaseNode(int Index) {
+		Nodes[Index].Callback = nullptr;
+
+		++Nodes[Index].Generation;
+
+		FreeNodes.push_back(Index);
+
+		--ScheduledCount;
+	}
+
+	/*
+	 * Cascade Functional:
+	 *	@description  : Move a Slot Of an Upper Level Down, Now That Its Time Range Is Reached
+	 *	@return value : The Slot Index Inside the Level
+	*/
+	int Cascade(int Level) {
+		int LevelSlot = static_cast<int>((CurrentTick >> (SlotBits * Level)) & SlotMask);
+		int Slot      = Level * SlotCount + LevelSlot;
+
+		int Index = Heads[Slot];
+
+		Heads[Slot] = -1;
+
+		while (Index != -1) {
+			int Next = Nodes[Index].Next;
+
+			LinkNode(Index);
+
+			Index = Next;
+		}
+
+		return LevelSlot;
+	}
+
+	/*
+	 * ToTick Functional:
+	 *	@description  : The First Tick Not Earlier Than the Time ( Microseconds )
+	*/
+	static long long ToTick(long long Time) {
+		return Time >= 0 ? (Time + TickLength - 1) / TickLength : Time / TickLength;
+	}
+
+public:
+	/*
+	 * Build up Functional
+	*/
+
+	VTimerWheel() {
+		for (auto& Head : Heads) {
+			Head = -1;
+		}
+
+		CurrentTick = ToTick(VClock::Instance().FrameTime());
+	}
+
+	VTimerWheel(const VTimerWheel&) = delete;
+	void operator=(const VTimerWheel&) = delete;
+
+public:
+	/*
+	 * SetTimeout Functional:
+	 *	@description  : Call Back Once After the Delay ( Milliseconds, From the Frame Time )
+	*/
+	VTimerHandle SetTimeout(long long Delay, std::function<void()> Callback) {
+		int Index = 0;
+
+		if (FreeNodes.empty() == false) {
+			Index = FreeNodes.back();
+
+			FreeNodes.pop_back();
+		}
+		else {
+			Index = static_cast<int>(Nodes.size());
+
+			Nodes.emplace_back();
+		}
+
+		TimerNode& Node = Nodes[Index];
+
+		Node.Callback = std::move(Callback);
+		Node.Expires  = ToTick(VClock::Instance().FrameTime() + (Delay > 0 ? Delay : 0) * TickLength);
+
+		LinkNode(Index);
+
+		++ScheduledCount;
+
+		VTimerHandle Handle;
+		Handle.Index      = static_cast<unsigned int>(Index);
+		Handle.Generation = Node.Generation;
+
+		return Handle;
+	}
+	/*
+	 * Cancel Functional:
+	 *	@description  : Drop a Timer Before It Fires ( Stale Handles Are Ignored ), the Handle Is Cleared
+	*/
+	void Cancel(VTimerHandle& Handle) {
+		if (IsScheduled(Handle) == true) {
+			UnlinkNode(static_cast<int>(Handle.Index));
+			ReleaseNode(static_cast<int>(Handle.Index));
+		}
+
+		Handle = VTimerHandle();
+	}
+	/*
+	 * Debounce Functional:
+	 *	@description  : Push the Timer Back, the Callback Only Runs Once the Calls Stop For the Delay
+	*/
+	void Debounce(VTimerHandle& Handle, long long Delay, std::function<void()> Callback) {
+		Cancel(Handle);
+
+		Handle = SetTimeout(Delay, std::move(Callback));
+	}
+	/*
+	 * IsScheduled Functional:
+	 *	@description  : Is the Timer Still Waiting
+	*/
+	bool IsScheduled(const VTimerHandle& Handle) const {
+		return Handle.Index < Nodes.size() && Nodes[Handle.Index].Generation == Handle.Generation &&
+			Nodes[Handle.Index].Slot != -1;
+	}
+	/*
+	 * IsEmpty Functional:
+	 *	@description  : Is No Timer Waiting
+	*/
+	bool IsEmpty() const {
+		return ScheduledCount == 0;
+	}
+
+	/*
+	 * Advance Functional:
+	 *	@description  : Fire Every Timer Expired At the Time ( Microseconds ), Callbacks May Schedule Or Cancel
+	 *	@return value : How Many Timers Fired
+	*/
+	size_t Advance(long long Time) {
+		long long TargetTick = Time / TickLength;
+		size_t    FiredCount = 0;
+
+		if (ScheduledCount == 0) {
+			CurrentTick = TargetTick + 1 > CurrentTick ? TargetTick + 1 : CurrentTick;
+
+			return 0;
+		}
+
+		while (CurrentTick <= TargetTick) {
+			int Slot = static_cast<int>(CurrentTick & SlotMask);
+
+			if (Slot == 0) {
+				for (int Level = 1; Level < LevelCount && Cascade(Level) == 0; ++Level) {
+				}
+			}
+
+			while (Heads[Slot] != -1) {
+				int Index = Heads[Slot];
+
+				UnlinkNode(Index);
+
+				std::function<void()> Callback = std::move(Nodes[Index].Callback);
+
+				/* Released Before Calling, the Callback May Reuse the Node */
+				ReleaseNode(Index);
+
+				Firing = true;
+
+				Callback();
+
+				Firing = false;
+
+				++FiredCount;
+			}
+
+			++CurrentTick;
+
+			if (ScheduledCount == 0) {
+				CurrentTick = TargetTick + 1 > CurrentTick ? TargetTick + 1 : CurrentTick;
+			}
+		}
+
+		return FiredCount;
+	}
+
+	/*
+	 * GetTimeToNextExpiry Functional:
+	 *	@description  : How Long Until Advance Has Work To Do ( Microseconds, -1 If No Timer ),
+	 *					a Far Timer Only Reports When Its Slot Is Cascaded
+	*/
+	long long GetTimeToNextExpiry(long long Time) const {
+		if (ScheduledCount == 0) {
+			return -1;
+		}
+
+		long long NextTick = LLONG_MAX;
+
+		/* Level 0 Holds the Next 64 Ticks */
+		for (long long Tick = CurrentTick; Tick < CurrentTick + SlotCount; ++Tick) {
+			if (Heads[Tick & SlotMask] != -1) {
+				NextTick = Tick;
+
+				break;
+			}
+		}
+
+		/* Upper Levels Need Attention When Their Next Used Slot Is Cascaded */
+		for (int Level = 1; Level < LevelCount; ++Level) {
+			long long Base = CurrentTick >> (SlotBits * Level);
+
+			/* On a Block Boundary the Current Slot Is Not Cascaded Yet */
+			long long FirstOffset = (CurrentTick & ((1ll << (SlotBits * Level)) - 1)) == 0 ? 0 : 1;
+
+			for (long long Offset = FirstOffset; Offset <= SlotCount; ++Offset) {
+				if (Heads[Level * SlotCount + static_cast<int>((Base + Offset) & SlotMask)] != -1) {
+					long long CascadeTick = (Base + Offset) << (SlotBits * Level);
+
+					NextTick = CascadeTick < NextTick ? CascadeTick : NextTick;
+
+					break;
+				}
+			}
+		}
+
+		long long Rest = NextTick * TickLength - Time;
+
+		return Rest > 0 ? Rest : 0;
+	}
+};
+
+VLIB_END_NAMESPACE
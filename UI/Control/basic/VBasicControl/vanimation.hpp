@@ -6,18 +6,16 @@
 #pragma once
 
 #include "vbasicanimation.hpp"
-#include "../../../basic/vbasic/vtimer.hpp"
 
 VLIB_BEGIN_NAMESPACE
 
 class VGeomteryAnimation : public VUIObject {
 private:
 	VSizeInterpolator* Interpolator;
-	VTimer             FpsTimer;
 
 public:
 	VGeomteryAnimation(VUIObject* Parent, int Duraction, VInterpolatorType InterpolatorType) : VUIObject(Parent) {
-		Interpolator = new VSizeInterpolator(36.f / Duraction, InterpolatorType);
+		Interpolator = new VSizeInterpolator(Duraction, InterpolatorType);
 	}
 
 public:
@@ -25,26 +23,26 @@ public:
 		Interpolator->Start(
 			{ Parent()->GetWidth(), Parent()->GetHeight() }, NewGeomtery);
 
-		FpsTimer.Start(36);
+		StartAnimationTick();
 	}
 
-	void CheckFrame() override {
-		if (Interpolator->IsAnimationEnd() == false && FpsTimer.End() == true) {
-			Parent()->Resize(Interpolator->GetOneFrame());
-
-			FpsTimer.Start(36);
+	bool TickAnimation() override {
+		if (Interpolator->IsAnimationEnd() == true) {
+			return false;
 		}
+
+		Parent()->Resize(Interpolator->GetOneFrame());
+
+		return true;
 	}
 };
 class VPositionAnimation : public VUIObject {
 private:
 	VPositionInterpolator* Interpolator;
 
-	VTimer                 FpsTimer;
-
 public:
 	VPositionAnimation(VUIObject* Parent, int Duraction, VInterpolatorType InterpolatorType) : VUIObject(Parent) {
-		Interpolator = new VPositionInterpolator(36.f / Duraction, InterpolatorType);
+		Interpolator = new VPositionInterpolator(Duraction, InterpolatorType);
 	}
 
 public:
@@ -52,41 +50,43 @@ public:
 		Interpolator->Start(
 			{ Parent()->GetX(), Parent()->GetY() }, NewPosition);
 
-		FpsTimer.Start(36);
+		StartAnimationTick();
 	}
 
-	void CheckFrame() override {
-		if (Interpolator->IsAnimationEnd() == false && FpsTimer.End() == true) {
-			Parent()->Move(Interpolator->GetOneFrame());
-
-			FpsTimer.Start(36);
+	bool TickAnimation() override {
+		if (Interpolator->IsAnimationEnd() == true) {
+			return false;
 		}
+
+		Parent()->Move(Interpolator->GetOneFrame());
+
+		return true;
 	}
 };
 class VAlphaAnimation : public VUIObject {
 private:
 	VAlphaInterpolator* Interpolator;
 
-	VTimer              FpsTimer;
-
 public:
 	VAlphaAnimation(VUIObject* Parent, int Duraction, VInterpolatorType InterpolatorType) : VUIObject(Parent) {
-		Interpolator = new VAlphaInterpolator(36.f / Duraction, InterpolatorType);
+		Interpolator = new VAlphaInterpolator(Duraction, InterpolatorType);
 	}
 
 public:
 	void Start(short NewAlpha) {
 		Interpolator->Start(Parent()->GetTransparency(), NewAlpha);
 
-		FpsTimer.Start(36);
+		StartAnimationTick();
 	}
 
-	void CheckFrame() override {
-		if (Interpolator->IsAnimationEnd() == false && FpsTimer.End() == true) {
-			Parent()->SetTransparency(Interpolator->GetOneFrame());
-
-			FpsTimer.Start(36);
+	bool TickAnimation() override {
+		if (Interpolator->IsAnimationEnd() == true) {
+			return false;
 		}
+
+		Parent()->SetTransparency(Interpolator->GetOneFrame());
+
+		return true;
 	}
 };
 
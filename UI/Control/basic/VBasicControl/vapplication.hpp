@@ -8,6 +8,16 @@
 
 #include "vuiobject.hpp"
 
+#include "../../../basic/vbasic/vclock.hpp"
+#include "../../../basic/vbasic/vframescheduler.hpp"
+#include "../../../basic/vbasic/vmailbox.hpp"
+#include "../../../basic/vbasic/vtaskqueue.hpp"
+#include "../../../basic/vbasic/vtimerwheel.hpp"
+
+#include <atomic>
+#include <climits>
+#include <deque>
+
 VLIB_BEGIN_NAMESPACE
 
 class VCoreApplication;
@@ -19,83 +29,280 @@ VCoreApplication* _VL_Core_Application = nullptr;
  *	@description  : The Basic Application In VLib
 */
 class VCoreApplication : public VUIObject {
+protected:
+	/*
+	 * FrameScheduler Variable:
+	 *	@description  : Paces Every Window's Frame On the Display Cadence
+	*/
+	VFrameScheduler        FrameScheduler;
+	/*
+	 * TimerWheel Variable:
+	 *	@description  : Every Timeout And Debounce Of the Application, Fired Once Per Loop Turn
+	*/
+	VTimerWheel            TimerWheel;
+	/*
+	 * TaskQueue Variable:
+	 *	@description  : Long UI Thread Jobs, Sliced Under a Budget After Each Frame
+	*/
+	VTaskQueue             TaskQueue;
+
+	/*
+	 * SyntheticMessageQueue Variable:
+	 *	@description  : Injected Messages, Patched Before the Win32 Ones
+	*/
+	std::deque<VInputMessageStorage> SyntheticMessageQueue;
+
+protected:
+	/*
+	 * WakeEvent Variable:
+	 *	@description  : Signaled To Wake the Loop Up From Other Threads ( Window Procedure, Workers )
+	*/
+	HANDLE                                WakeEvent;
+	DWORD                                 UIThreadID;
+
+	/*
+	 * FrameRequested & WakeDeadline Variable:
+	 *	@description  : Someone Needs the Next Frame / the Earliest Time Someone Needs a Tick,
+	 *					the Loop Sleeps When Neither Is Pending ( Deadline On VClock, Microseconds )
+	*/
+	std::atomic<bool>                     FrameRequested;
+	long long                             WakeDeadline;
+
+protected:
+	/*
+	 * IsTickPending Functional:
+	 *	@description  : Does Anyone Need a Tick Now
+	*/
+	bool  IsTickPending() {
+		return FrameRequested.load() == true || _VL_Animation_Registry.IsEmpty() == false ||
+			TaskQueue.IsEmpty() == false || VClock::Instance().Now() >= WakeDeadline;
+	}
+	/*
+	 * ClearTickRequest Functional:
+	 *	@description  : Forget the Requests, Objects Ask Again During the Tick If They Still Need One
+	*/
+	void  ClearTickRequest() {
+		FrameRequested.store(false);
+
+		WakeDeadline = LLONG_MAX;
+	}
+	/*
+	 * GetWaitTimeout Functional:
+	 *	@description  : How Long the Loop Could Block ( Milliseconds, Rounded Up )
+	*/
+	DWORD GetWaitTimeout() {
+		long long WaitTime = LLONG_MAX;
+
+		if (IsTickPending() == true) {
+			WaitTime = FrameScheduler.GetTimeToNextSlot();
+		}
+		else if (WakeDeadline != LLONG_MAX) {
+			WaitTime = WakeDeadline - VClock::Instance().Now();
+		}
+
+		long long TimerWaitTime = TimerWheel.GetTimeToNextExpiry(VClock::Instance().Now());
+
+		if (TimerWaitTime >= 0 && TimerWaitTime < WaitTime) {
+			WaitTime = TimerWaitTime;
+		}
+
+		if (WaitTime == LLONG_MAX) {
+			return INFINITE;
+		}
+
+		return WaitTime > 0 ? static_cast<DWORD>((WaitTime + 999) / 1000) : 0;
+	}
+	/*
+	 * WaitForWake Functional:
+	 *	@description  : Block Until New Input, a Wake-up Or the Timeout
+	*/
+	void  WaitForWake(DWORD Timeout) {
+		if (Timeout != 0) {
+			MsgWaitForMultipleObjectsEx(1, &WakeEvent, Timeout, QS_ALLINPUT, 0);
+		}
+	}
+
+	/*
+	 * TickAnimations Functional:
+	 *	@description  : Step Every Running Animation
+	*/
+	void  TickAnimations() {
+		_VL_Animation_Registry.Tick([](VObjectHandle Handle) -> bool {
+			VUIObject* Object = VUIObject::FromHandle(Handle);
+
+			return Object != nullptr && Object->TickAnimation();
+		}, VClock::Instance().FrameTime(), FrameScheduler.GetFrameInterval());
+	}
+
+	/*
+	 * DispatchMailbox Functional:
+	 *	@description  : Run the Calls Posted From Other Threads ( Queued Signal Connections )
+	 *	@return value : Did Any Call Run
+	*/
+	bool  DispatchMailbox() {
+		return _VL_UI_Mailbox.Drain() != 0;
+	}
+	/*
+	 * FireTimers Functional:
+	 *	@description  : Run the Expired Timeouts In One Pass
+	*/
+	void  FireTimers() {
+		TimerWheel.Advance(VClock::Instance().FrameTime());
+	}
+
+public:
+	/*
+	 * GetFrameScheduler Functional:
+	 *	@description  : Get the Application's Frame Scheduler
+	*/
+	VFrameScheduler* GetFrameScheduler() {
+		return &FrameScheduler;
+	}
+	/*
+	 * GetTimerWheel Functional:
+	 *	@description  : Get the Application's Timer Wheel ( SetTimeout, Debounce, Cancel; UI Thread Only )
+	*/
+	VTimerWheel* GetTimerWheel() {
+		return &TimerWheel;
+	}
+	/*
+	 * GetTaskQueue Functional:
+	 *	@description  : Get the Application's Cooperative Task Queue ( Post, Cancel, SetBudget; UI Thread Only )
+	*/
+	VTaskQueue* GetTaskQueue() {
+		return &TaskQueue;
+	}
+
+	/*
+	 * Wake Functional:
+	 *	@description  : Wake the Loop Up ( Thread Safe )
+	*/
+	void Wake() {
+		SetEvent(WakeEvent);
+	}
+	/*
+	 * RequestNextFrame Functional:
+	 *	@description  : Ask For a Tick On the Next Frame Slot ( Thread Safe )
+	*/
+	void RequestNextFrame() {
+		FrameRequested.store(true);
+
+		if (GetCurrentThreadId() != UIThreadID) {
+			Wake();
+		}
+	}
+	/*
+	 * RequestWakeUp Functional:
+	 *	@description  : Ask For a Tick After a Delay ( Microseconds, UI Thread Only )
+	*/
+	void RequestWakeUp(long long Delay) {
+		long long Deadline = VClock::Instance().Now() + (Delay > 0 ? Delay : 0);
+
+		if (Deadline < WakeDeadline) {
+			WakeDeadline = Deadline;
+		}
+	}
+
 public:
 	/*
 	 * PatchEvent Functional:
-	 *	@description : Peek a Message From Win32
+	 *	@description : Peek a Message From Win32 Into Storage ( No Heap Allocation ), Messages
+	 *					Which Are Not Converted ( Window Messages, Double Clicks ... ) Leave Storage Empty
+	 *	@return value : Was a Message Taken, false Only When the Queue Is Empty
 	*/
-	VMessage* PatchEvent() {
-		VMessage* ResultEvent = nullptr;
+	bool PatchEvent(VInputMessageStorage& Storage) {
+		Storage.Clear();
+
+		if (SyntheticMessageQueue.empty() == false) {
+			Storage = SyntheticMessageQueue.front();
+			SyntheticMessageQueue.pop_front();
+
+			return true;
+		}
 
 		ExMessage EasyxMessage;
-		peekmessage(&EasyxMessage);
+
+		if (peekmessage(&EasyxMessage) == false) {
+			return false;
+		}
 
 		/* Convert EasyX Message To VMessage */
 		switch (EasyxMessage.message) {
 		case WM_LBUTTONUP: {
-			ResultEvent = new VMouseClickedMessage(EasyxMessage.x, EasyxMessage.y,
+			Storage.Emplace<VMouseClickedMessage>(EasyxMessage.x, EasyxMessage.y,
 				VMouseClickedFlag::Up, VMouseKeyFlag::Left);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_LBUTTONDOWN: {
-			ResultEvent = new VMouseClickedMessage(EasyxMessage.x, EasyxMessage.y,
+			Storage.Emplace<VMouseClickedMessage>(EasyxMessage.x, EasyxMessage.y,
 				VMouseClickedFlag::Down, VMouseKeyFlag::Left);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_RBUTTONUP: {
-			ResultEvent = new VMouseClickedMessage(EasyxMessage.x, EasyxMessage.y,
+			Storage.Emplace<VMouseClickedMessage>(EasyxMessage.x, EasyxMessage.y,
 				VMouseClickedFlag::Up, VMouseKeyFlag::Right);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_RBUTTONDOWN: {
-			ResultEvent = new VMouseClickedMessage(EasyxMessage.x, EasyxMessage.y,
+			Storage.Emplace<VMouseClickedMessage>(EasyxMessage.x, EasyxMessage.y,
 				VMouseClickedFlag::Down, VMouseKeyFlag::Right);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_MBUTTONUP: {
-			ResultEvent = new VMouseClickedMessage(EasyxMessage.x, EasyxMessage.y,
+			Storage.Emplace<VMouseClickedMessage>(EasyxMessage.x, EasyxMessage.y,
 				VMouseClickedFlag::Up, VMouseKeyFlag::Middle);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_MBUTTONDOWN: {
-			ResultEvent = new VMouseClickedMessage(EasyxMessage.x, EasyxMessage.y,
+			Storage.Emplace<VMouseClickedMessage>(EasyxMessage.x, EasyxMessage.y,
 				VMouseClickedFlag::Down, VMouseKeyFlag::Middle);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_MOUSEMOVE: {
-			ResultEvent = new VMouseMoveMessage(EasyxMessage.x, EasyxMessage.y);
+			Storage.Emplace<VMouseMoveMessage>(EasyxMessage.x, EasyxMessage.y);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_MOUSEWHEEL: {
-			ResultEvent = new VMouseWheelMessage(EasyxMessage.x, EasyxMessage.y, EasyxMessage.wheel);
+			Storage.Emplace<VMouseWheelMessage>(EasyxMessage.x, EasyxMessage.y, EasyxMessage.wheel);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_KEYUP: {
-			ResultEvent = new VKeyClickedMessage(EasyxMessage.vkcode, EasyxMessage.prevdown, EasyxMessage.extended, VkeyClickedFlag::Up);
+			Storage.Emplace<VKeyClickedMessage>(EasyxMessage.vkcode, EasyxMessage.prevdown, EasyxMessage.extended, VkeyClickedFlag::Up);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_KEYDOWN: {
-			ResultEvent = new VKeyClickedMessage(EasyxMessage.vkcode, EasyxMessage.prevdown, EasyxMessage.extended, VkeyClickedFlag::Down);
+			Storage.Emplace<VKeyClickedMessage>(EasyxMessage.vkcode, EasyxMessage.prevdown, EasyxMessage.extended, VkeyClickedFlag::Down);
 
-			return ResultEvent;
+			break;
 		}
 		case WM_CHAR: {
-			VIMECharMessage* obj_message = new VIMECharMessage(EasyxMessage.ch);
+			Storage.Emplace<VIMECharMessage>(EasyxMessage.ch);
 
-			return ResultEvent;
+			break;
 		}
 		}
 
-		return nullptr;
+		return true;
+	}
+
+	/*
+	 * PostSyntheticMessage Functional:
+	 *	@description  : Inject a Input Message ( Mouse, Key ... ) As If It Came From Win32,
+	 *					the Message Is Copied
+	*/
+	template<class _Message>
+	void PostSyntheticMessage(const _Message& Message) {
+		SyntheticMessageQueue.emplace_back();
+		SyntheticMessageQueue.back().Emplace<_Message>(Message);
 	}
 
 	/*
@@ -111,8 +318,20 @@ public:
 	 * Build up Functional
 	*/
 
-	VCoreApplication() : VUIObject(nullptr) {
+	VCoreApplication() : VUIObject(nullptr), FrameRequested(true) {
+		WakeEvent    = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+		UIThreadID   = GetCurrentThreadId();
+		WakeDeadline = LLONG_MAX;
+
+		/* A Batch Of Posted Calls Wakes the Loop Once */
+		_VL_UI_Mailbox.SetWaker([](void* Context) {
+			static_cast<VCoreApplication*>(Context)->Wake();
+		}, this);
+	}
+	~VCoreApplication() override {
+		_VL_UI_Mailbox.SetWaker(nullptr, nullptr);
 
+		CloseHandle(WakeEvent);
 	}
 
 	/*
@@ -129,49 +348,110 @@ public:
  *	@description  : The Application Class In VLib
 */
 class VApplication : public VCoreApplication {
-private:
-	std::vector<VTheme*> ThemeList;
-
 private:
 	/*
 	 * InitTheme class:
-	 *	@description  : Init the Native Theme
+	 *	@description  : Register the Native Themes Into the Theme Registry
 	*/
 	void InitTheme() {
-		ThemeList.push_back(new VPushButtonTheme());
-		ThemeList.push_back(new VTextLabelTheme());
-		ThemeList.push_back(new VWidgetTheme());
-		ThemeList.push_back(new VBlurLabelTheme());
-		ThemeList.push_back(new VImageLabelTheme());
-		ThemeList.push_back(new VIconButtonTheme());
-		ThemeList.push_back(new VScrollBarTheme());
-		ThemeList.push_back(new VScrollButtonTheme());
+		VThemeRegistry& Registry = VThemeRegistry::Instance();
+
+		Registry.Register(new VPushButtonTheme());
+		Registry.Register(new VTextLabelTheme());
+		Registry.Register(new VWidgetTheme());
+		Registry.Register(new VBlurLabelTheme());
+		Registry.Register(new VImageLabelTheme());
+		Registry.Register(new VIconButtonTheme());
+		Registry.Register(new VScrollBarTheme());
+		Registry.Register(new VScrollButtonTheme());
 	}
 
-protected:
+private:
 	/*
-	 * GetThemeListFromParent override Functional:
-	 *	@description  : Get the Theme List
+	 * CoalescedMessages Variable:
+	 *	@description  : The Patched Messages Of This Turn After Coalescing ( Reused Every Turn )
 	*/
-	std::vector<VTheme*> GetThemeListFromParent() override {
-		return ThemeList;
+	std::vector<VInputMessageStorage> CoalescedMessages;
+
+	/*
+	 * CoalesceEvent Functional:
+	 *	@description  : Merge a Patched Message Into the Previous One If Possible:
+	 *					Consecutive Mouse Moves Keep the Latest, Consecutive Wheels Sum Their Deltas,
+	 *					Consecutive Auto-repeats Of a Key Count Up
+	*/
+	void CoalesceEvent(const VInputMessageStorage& Storage) {
+		VInputMessageStorage NewStorage = Storage;
+		VMessage*            NewMessage = NewStorage.Get();
+
+		if (CoalescedMessages.empty() == false &&
+			CoalescedMessages.back().Get()->GetType() == NewMessage->GetType()) {
+			VMessage* LastMessage = CoalescedMessages.back().Get();
+
+			switch (NewMessage->GetType()) {
+			case VMessageType::MouseMoveMessage: {
+				CoalescedMessages.back() = NewStorage;
+
+				return;
+			}
+			case VMessageType::MouseWheelMessage: {
+				auto LastWheel = static_cast<VMouseWheelMessage*>(LastMessage);
+				auto NewWheel  = static_cast<VMouseWheelMessage*>(NewMessage);
+
+				int  WheelSum  = LastWheel->WheelValue + NewWheel->WheelValue;
+
+				/* Don't Let the Sum Overflow short, Start a New Message Instead */
+				if (WheelSum <= SHRT_MAX && WheelSum >= SHRT_MIN) {
+					LastWheel->MousePosition = NewWheel->MousePosition;
+					LastWheel->WheelValue    = static_cast<short>(WheelSum);
+
+					return;
+				}
+
+				break;
+			}
+			case VMessageType::KeyClickedMessage: {
+				auto LastKey = static_cast<VKeyClickedMessage*>(LastMessage);
+				auto NewKey  = static_cast<VKeyClickedMessage*>(NewMessage);
+
+				if (LastKey->KeyVKCode == NewKey->KeyVKCode &&
+					LastKey->KeyStats == VkeyClickedFlag::Down && NewKey->KeyStats == VkeyClickedFlag::Down &&
+					LastKey->KeyPrevDown == true && NewKey->KeyPrevDown == true &&
+					LastKey->KeyRepeatCount < USHRT_MAX) {
+					++LastKey->KeyRepeatCount;
+
+					return;
+				}
+
+				break;
+			}
+			}
+		}
+
+		CoalescedMessages.push_back(NewStorage);
 	}
 
-private:
 	/*
 	 * ProcessEvent Functional:
-	 *	@description  : Dealy the Pathced Message
+	 *	@description  : Patch Every Pending Message, Coalesce Them, Then Dealy
+	 *	@return value : Was There Any Message
 	*/
-	void ProcessEvent(VMessage* PatchedMessage) {
-		PatchedMessage = PatchEvent();
+	bool ProcessEvent() {
+		VInputMessageStorage MessageStorage;
 
-		while (PatchedMessage != nullptr) {
-			SysDealyMessage(PatchedMessage);
+		CoalescedMessages.clear();
 
-			delete PatchedMessage;
+		/* Skip the Unconverted Messages, the Input Behind Them Must Still Be Drained */
+		while (PatchEvent(MessageStorage) == true) {
+			if (MessageStorage.Get() != nullptr) {
+				CoalesceEvent(MessageStorage);
+			}
+		}
 
-			PatchedMessage = PatchEvent();
+		for (auto& Message : CoalescedMessages) {
+			SysDealyMessage(Message.Get());
 		}
+
+		return CoalescedMessages.empty() == false;
 	}
 
 public:
@@ -182,6 +462,8 @@ public:
 	VApplication() {
 		InitTheme();
 
+		CoalescedMessages.reserve(64);
+
 		if (VUnlikely(VCoreApplication::Instance() == nullptr)) {
 			_VL_Core_Application = this;
 		}
@@ -190,20 +472,61 @@ public:
 		}
 	}
 
+	/*
+	 * ExecFrame Functional:
+	 *	@description  : Run One Loop Turn Without Waiting For the Frame Slot ( For Headless Runs And Benchmarks )
+	*/
+	void ExecFrame() {
+		VClock::Instance().SampleFrameTime();
+
+		ProcessEvent();
+		DispatchMailbox();
+		FireTimers();
+
+		TickAnimations();
+		CheckAllFrame();
+
+		TaskQueue.Run();
+	}
+
 	/*
 	 * Exec Functional:
 	 *	@descipriton  : The Event Loop Of Application
 	*/
 	int Exec() {
-		VMessage* PatchedMessage = nullptr;
-
 		while (true) {
-			/* Dealy the Event */
-			ProcessEvent(PatchedMessage);
+			/* One Timestamp Per Loop Turn, Shared By the Handlers, Timers And Animations */
+			VClock::Instance().SampleFrameTime();
+
+			/* Dealy the Event, Input Always Gets a Frame To Show Its Effect */
+			if (ProcessEvent() == true) {
+				RequestNextFrame();
+			}
+			/* Results From Worker Threads Arrive Here, In One Batch Per Loop Turn */
+			if (DispatchMailbox() == true) {
+				RequestNextFrame();
+			}
+
+			/* Timeouts Which Change Something Ask For a Frame Themselves ( Update ) */
+			FireTimers();
+
+			/* Only Tick the Windows When Someone Needs It And a Frame Slot Is Reached */
+			if (IsTickPending() == true && FrameScheduler.IsFrameSlot() == true) {
+				FrameScheduler.AdvanceSlot();
+
+				ClearTickRequest();
+
+				TickAnimations();
+				CheckAllFrame();
+
+				/* Jobs Get What Is Left Of the Frame, the Rest Resumes Next Frame So Input Is Never Starved */
+				TaskQueue.Run();
 
-			CheckAllFrame();
+				continue;
+			}
 
-			Sleep(1);
+			/* Block Until Input Or the Nearest Deadline, an Idle Application Never Wakes */
+			WaitForWake(GetWaitTimeout());
 		}
 
 		/* Exit Not Normaly */
@@ -7,6 +7,7 @@
 #pragma warning(disable : 26451)
 
 #include "vuiobject.hpp"
+#include "../../../basic/vbasic/vclock.hpp"
 
 VLIB_BEGIN_NAMESPACE
 
@@ -63,105 +64,142 @@ enum class VInterpolatorType {
 };
 
 /*
- * VAnimationInterpolator class:
- *	@description  : The Basic Interpolator of Animation
+ * VEasingCurve class:
+ *	@description  : A Interpolator Functional Sampled Into a Table, Read With Linear Interpolation
+ *					( No pow / cos / sin Per Frame, Within 1e-4 Of the Functional )
 */
-class VAnimationInterpolator {
+class VEasingCurve {
+public:
+	static const int SampleCount = 256;
+
 private:
-	double                        InterpolatorDuration;
-	std::function<double(double)> InterpolatorFunction;
+	float Samples[SampleCount + 1];
 
 public:
-	double                        LocalX = 0;
+	explicit VEasingCurve(double (*Function)(double)) {
+		for (int Count = 0; Count <= SampleCount; ++Count) {
+			Samples[Count] = static_cast<float>(Function(static_cast<double>(Count) / SampleCount));
+		}
+	}
 
-public:
 	/*
-	 * Build up
+	 * Sample Functional:
+	 *	@description  : Read the Curve At X ( 0 ~ 1, Clamped )
 	*/
+	double Sample(double X) const {
+		if (X <= 0) {
+			return Samples[0];
+		}
+		if (X >= 1) {
+			return Samples[SampleCount];
+		}
 
-	VAnimationInterpolator(double Dx, VInterpolatorType Interpolator) {
-		InterpolatorDuration = Dx;
-
-		using namespace VInterpolatorFunctional;
-
-		switch (Interpolator) {
-		case VInterpolatorType::AnticipateInterpolator:
-			InterpolatorFunction = AnticipateInterpolator;
-
-			break;
-		case VInterpolatorType::AccelerateDecelerateInterpolator:
-			InterpolatorFunction = AccelerateDecelerateInterpolator;
+		double Position = X * SampleCount;
+		int    Index    = static_cast<int>(Position);
 
-			break;
-		case VInterpolatorType::AccelerateInterpolator:
-			InterpolatorFunction = AccelerateInterpolator;
+		return Samples[Index] + (Samples[Index + 1] - Samples[Index]) * (Position - Index);
+	}
 
-			break;
-		case VInterpolatorType::AnticipateOvershootInterpolator:
-			InterpolatorFunction = AnticipateOvershootInterpolator;
+	/*
+	 * Get Functional:
+	 *	@description  : Get the Table Of a Interpolator Type ( Built Once )
+	*/
+	static const VEasingCurve& Get(VInterpolatorType Type) {
+		using namespace VInterpolatorFunctional;
 
-			break;
-		case VInterpolatorType::DecelerateInterpolator:
-			InterpolatorFunction = DecelerateInterpolator;
+		/* The Same Order As VInterpolatorType */
+		static const VEasingCurve Curves[] = {
+			VEasingCurve(AnticipateInterpolator),
+			VEasingCurve(AccelerateDecelerateInterpolator),
+			VEasingCurve(AccelerateInterpolator),
+			VEasingCurve(AnticipateOvershootInterpolator),
+			VEasingCurve(DecelerateInterpolator),
+			VEasingCurve(LinearInterpolator),
+			VEasingCurve(OvershootInterpolator),
+			VEasingCurve(CycleInterpolator)
+		};
+
+		int Index = static_cast<int>(Type);
+
+		return Curves[Index >= 0 && Index < static_cast<int>(sizeof(Curves) / sizeof(Curves[0])) ? Index : 0];
+	}
+};
 
-			break;
-		case VInterpolatorType::LinearInterpolator:
-			InterpolatorFunction = LinearInterpolator;
+/*
+ * VAnimationInterpolator class:
+ *	@description  : The Basic Interpolator of Animation, the Progress Comes From the Start Time
+ *					And the Duration At the Frame Time Of VClock ( Late Frames Skip, Never Slow Down )
+*/
+class VAnimationInterpolator {
+private:
+	long long                     InterpolatorDuration;
+	long long                     StartTime = 0;
+	bool                          Finished  = true;
 
-			break;
-		case VInterpolatorType::OvershootInterpolator:
-			InterpolatorFunction = OvershootInterpolator;
+	const VEasingCurve*           InterpolatorCurve;
 
-			break;
-		case VInterpolatorType::CycleInterpolator:
-			InterpolatorFunction = CycleInterpolator;
+public:
+	/*
+	 * Build up ( Duration In Milliseconds )
+	*/
 
-			break;
-		default:
-			InterpolatorFunction = AnticipateInterpolator;
+	VAnimationInterpolator(long long Duration, VInterpolatorType Interpolator) {
+		SetDuration(Duration);
 
-			break;
-		}
-	}
-	VAnimationInterpolator(double Dx, std::function<double(double)> Interpolator) {
-		InterpolatorDuration = Dx;
-		InterpolatorFunction = Interpolator;
+		/* Resolved Once Here, Each Frame Is Only a Table Lookup */
+		InterpolatorCurve = &VEasingCurve::Get(Interpolator);
 	}
 
 public:
 	/*
 	 * InterpolatorEnd Functional:
-	 *	@description  : Is the InterpolatorEnd End
+	 *	@description  : Is the InterpolatorEnd End ( The Last Frame Was Already Given Out )
 	*/
 	bool  InterpolatorEnd() {
-		return (LocalX >= 1 + InterpolatorDuration);
+		return Finished;
 	}
 
-	double GetOneFrame() {
-		if (InterpolatorEnd() == true) {
+	/*
+	 * GetProgress Functional:
+	 *	@description  : The Linear Progress At the Frame Time ( 0 ~ 1 )
+	*/
+	double GetProgress() const {
+		long long Elapsed = VClock::Instance().FrameTime() - StartTime;
+
+		if (Elapsed >= InterpolatorDuration) {
 			return 1.f;
 		}
 
-		if (LocalX <= 1) {
-			double Result = InterpolatorFunction(LocalX);
-			LocalX += InterpolatorDuration;
+		return Elapsed > 0 ? static_cast<double>(Elapsed) / InterpolatorDuration : 0.f;
+	}
+
+	double GetOneFrame() {
+		double Progress = GetProgress();
+
+		if (Progress >= 1.f) {
+			Finished = true;
 
-			return Result;
-		}
-		else {
-			LocalX += InterpolatorDuration;
 			return 1.f;
 		}
 
-		return 0.f;
+		return InterpolatorCurve->Sample(Progress);
 	}
 
+	/*
+	 * Reset Functional:
+	 *	@description  : Start Over From the Current Frame Time
+	*/
 	void Reset() {
-		LocalX = 0;
+		StartTime = VClock::Instance().FrameTime();
+		Finished  = false;
 	}
 
-	void SetDx(double Dx) {
-		InterpolatorDuration = Dx;
+	/*
+	 * SetDuration Functional:
+	 *	@description  : Set How Long the Animation Lasts ( Milliseconds )
+	*/
+	void SetDuration(long long Duration) {
+		InterpolatorDuration = (Duration > 0 ? Duration : 1) * 1000;
 	}
 };
 
@@ -173,8 +211,8 @@ protected:
 	VAnimationInterpolator Interpolator;
 
 public:
-	VBasicInterpolator(double Dx, VInterpolatorType Type)
-		: Interpolator(Dx, Type) {
+	VBasicInterpolator(long long Duration, VInterpolatorType Type)
+		: Interpolator(Duration, Type) {
 
 	}
 
@@ -200,11 +238,11 @@ public:
 	}
 
 	/*
-	 * SetDx Functional:
-	 *	@description  : Set the Delta X
+	 * SetDuration Functional:
+	 *	@description  : Set the Duration ( Milliseconds )
 	*/
-	void SetDx(double Dx) {
-		Interpolator.SetDx(Dx);
+	void SetDuration(long long Duration) {
+		Interpolator.SetDuration(Duration);
 	}
 };
 
@@ -222,8 +260,8 @@ public:
 	 * Build up Functional
 	*/
 
-	VColorInterpolator(double Dx, VInterpolatorType Interpolator)
-		: VBasicInterpolator(Dx, Interpolator) {
+	VColorInterpolator(long long Duration, VInterpolatorType Interpolator)
+		: VBasicInterpolator(Duration, Interpolator) {
 
 	}
 	void Start(VColor Source, VColor Target) {
@@ -283,8 +321,8 @@ private:
 	VPoint SourcePoint;
 
 public:
-	VPositionInterpolator(double Dx, VInterpolatorType Interpolator)
-		: VBasicInterpolator(Dx, Interpolator) {
+	VPositionInterpolator(long long Duration, VInterpolatorType Interpolator)
+		: VBasicInterpolator(Duration, Interpolator) {
 
 	}
 	void Start(VPoint Source, VPoint Target) {
@@ -320,8 +358,8 @@ private:
 	short SourceAlpha = 0;
 
 public:
-	VAlphaInterpolator(double Dx, VInterpolatorType Interpolator)
-		: VBasicInterpolator(Dx, Interpolator) {
+	VAlphaInterpolator(long long Duration, VInterpolatorType Interpolator)
+		: VBasicInterpolator(Duration, Interpolator) {
 
 	}
 	void Start(short Source, short Target) {
@@ -354,8 +392,8 @@ private:
 	VSize TargetSize;
 
 public:
-	VSizeInterpolator(double Dx, VInterpolatorType Interpolator)
-		: VBasicInterpolator(Dx, Interpolator) {
+	VSizeInterpolator(long long Duration, VInterpolatorType Interpolator)
+		: VBasicInterpolator(Duration, Interpolator) {
 
 	}
 	void Start(VSize Source, VSize Target) {
@@ -7,6 +7,12 @@
 
 #include "vuiobject.hpp"
 
+#include "../../../render/vrender/vblur.hpp"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
 VLIB_BEGIN_NAMESPACE
 
 /*
@@ -15,7 +21,163 @@ VLIB_BEGIN_NAMESPACE
 */
 class VBlurLabel : public VUIObject {
 private:
-	VBlurLabelTheme* Theme;
+	VThemeHandle<VBlurLabelTheme> Theme;
+
+	/* The Backdrop As Last Copied ( Unblurred, Label Coordinates ) And Its Blurred Form */
+	std::vector<BYTE>             BackdropPixels;
+	std::unique_ptr<VImage>       BlurredBackdrop;
+
+	/* What the Cache Was Made For, a Move, Resize Or New Radius Rebuilds It */
+	VRect                         CacheRect;
+	int                           CacheBlurRadius = -1;
+
+	/*
+	 * Each Damage Under the Label Bumps the Generation And Joins PendingDamage ( Parent Coordinates ),
+	 * the Cache Is Tagged With the Generation It Has Seen
+	*/
+	unsigned long long            DamageGeneration = 1;
+	unsigned long long            CacheGeneration  = 0;
+	VRect                         PendingDamage;
+
+private:
+	/*
+	 * CopyBackdrop Functional:
+	 *	@description  : Copy the Parent Canvas Inside the Aera Into BackdropPixels
+	 *	@return value : The Pixels Which Really Changed ( Label Coordinates, Empty If None )
+	*/
+	VRect CopyBackdrop(VImagePixels& SourcePixels, VRect Aera) {
+		VRect CopyRect = Aera.Intersect(ObjectRect()).Intersect({ 0, 0, SourcePixels.GetWidth(), SourcePixels.GetHeight() });
+		VRect ChangedRect;
+
+		if (CopyRect.IsEmpty() == true) {
+			return ChangedRect;
+		}
+
+		int    Width     = GetWidth();
+		int    CopyWidth = CopyRect.GetWidth();
+		size_t CopyBytes = static_cast<size_t>(CopyWidth) * 4;
+
+		for (int Y = CopyRect.top; Y < CopyRect.bottom; ++Y) {
+			BYTE*       Cached = BackdropPixels.data() +
+				(static_cast<size_t>(Y - GetY()) * Width + (CopyRect.left - GetX())) * 4;
+			const BYTE* Source = SourcePixels.GetLine(Y) + CopyRect.left * 4;
+
+			if (memcmp(Cached, Source, CopyBytes) == 0) {
+				continue;
+			}
+
+			int First = 0;
+			int Last  = CopyWidth - 1;
+
+			while (memcmp(Cached + First * 4, Source + First * 4, 4) == 0) {
+				++First;
+			}
+			while (memcmp(Cached + Last * 4, Source + Last * 4, 4) == 0) {
+				--Last;
+			}
+
+			memcpy(Cached + First * 4, Source + First * 4, static_cast<size_t>(Last - First + 1) * 4);
+
+			VRect LineRect(CopyRect.left - GetX() + First, Y - GetY(), CopyRect.left - GetX() + Last + 1, Y - GetY() + 1);
+
+			if (ChangedRect.IsEmpty() == true) {
+				ChangedRect = LineRect;
+			}
+			else {
+				ChangedRect.FusionRect(LineRect);
+			}
+		}
+
+		return ChangedRect;
+	}
+	/*
+	 * BlurBackdrop Functional:
+	 *	@description  : Blur Again Only the Pixels a Change Can Reach ( the Changed Rect Grown By the Blur
+	 *					Support ), Read From a Window Grown Once More So Its Edges Do Not Show
+	 *	@return value : Is the Blurred Image Locked
+	*/
+	bool BlurBackdrop(VRect ChangedRect) {
+		int   Width   = GetWidth();
+		int   Support = VFastBlur::GetSupport(Theme->BlurRadius);
+		VRect Bounds(0, 0, Width, GetHeight());
+
+		VRect OutputRect = VRect(ChangedRect.left - Support, ChangedRect.top - Support,
+			ChangedRect.right + Support, ChangedRect.bottom + Support).Intersect(Bounds);
+		VRect WindowRect = VRect(OutputRect.left - Support, OutputRect.top - Support,
+			OutputRect.right + Support, OutputRect.bottom + Support).Intersect(Bounds);
+
+		int               WindowWidth = WindowRect.GetWidth();
+		std::vector<BYTE> WindowPixels(static_cast<size_t>(WindowWidth) * WindowRect.GetHeight() * 4);
+
+		for (int Y = WindowRect.top; Y < WindowRect.bottom; ++Y) {
+			memcpy(WindowPixels.data() + static_cast<size_t>(Y - WindowRect.top) * WindowWidth * 4,
+				BackdropPixels.data() + (static_cast<size_t>(Y) * Width + WindowRect.left) * 4, static_cast<size_t>(WindowWidth) * 4);
+		}
+
+		VFastBlur::Apply(WindowPixels.data(), static_cast<ptrdiff_t>(WindowWidth) * 4, WindowWidth, WindowRect.GetHeight(), Theme->BlurRadius);
+
+		VImagePixels TargetPixels(BlurredBackdrop.get());
+
+		if (TargetPixels.IsLocked() == false) {
+			return false;
+		}
+
+		for (int Y = OutputRect.top; Y < OutputRect.bottom; ++Y) {
+			memcpy(TargetPixels.GetLine(Y) + OutputRect.left * 4,
+				WindowPixels.data() + (static_cast<size_t>(Y - WindowRect.top) * WindowWidth + (OutputRect.left - WindowRect.left)) * 4,
+				static_cast<size_t>(OutputRect.GetWidth()) * 4);
+		}
+
+		return true;
+	}
+	/*
+	 * UpdateBlurCache Functional:
+	 *	@description  : Bring the Blurred Backdrop Up To Date, Nothing Is Read While No Damage Came
+	 *					And Nothing Is Blurred While the Damaged Pixels Stayed the Same
+	 *	@return value : Is the Cache Usable ( Otherwise the Pixels Could Not Be Locked )
+	*/
+	bool UpdateBlurCache() {
+		bool Rebuild = BlurredBackdrop == nullptr || CacheRect != ObjectRect() || CacheBlurRadius != Theme->BlurRadius;
+
+		if (Rebuild == false && CacheGeneration == DamageGeneration) {
+			return true;
+		}
+
+		VProfileScope("BlurCache", "Paint");
+
+		VImagePixels SourcePixels(GetParentCanvas(), true);
+
+		if (SourcePixels.IsLocked() == false) {
+			return false;
+		}
+
+		VRect ChangedRect;
+
+		if (Rebuild == true) {
+			BlurredBackdrop.reset(new VImage(GetWidth(), GetHeight()));
+			BackdropPixels.assign(static_cast<size_t>(GetWidth()) * GetHeight() * 4, 0);
+
+			CopyBackdrop(SourcePixels, ObjectRect());
+
+			ChangedRect = VRect(0, 0, GetWidth(), GetHeight());
+		}
+		else {
+			ChangedRect = CopyBackdrop(SourcePixels, PendingDamage);
+		}
+
+		if (ChangedRect.IsEmpty() == false && BlurBackdrop(ChangedRect) == false) {
+			BlurredBackdrop.reset();
+
+			return false;
+		}
+
+		CacheRect       = ObjectRect();
+		CacheBlurRadius = Theme->BlurRadius;
+		CacheGeneration = DamageGeneration;
+		PendingDamage   = VRect();
+
+		return true;
+	}
 
 public:
 	/*
@@ -23,22 +185,56 @@ public:
 	*/
 
 	VBlurLabel(VUIObject* Parent) : VUIObject(Parent) {
-		Theme = new VBlurLabelTheme(*(static_cast<VBlurLabelTheme*>(SearchThemeFromParent(VBLURLABEL_THEME))));
+		Theme = GetThemeHandle<VBlurLabelTheme>(VBLURLABEL_THEME);
+	}
+
+	/*
+	 * ReadsBackdrop override Functional:
+	 *	@description  : The Blur Label Samples Parent Canvas
+	*/
+	bool ReadsBackdrop() override {
+		return true;
+	}
+	/*
+	 * BackdropDamaged override Functional:
+	 *	@description  : Remember Where the Backdrop May Have Changed ( Its Own Updates Come Here Too,
+	 *					They Are Told Apart Later By Comparing the Pixels )
+	*/
+	void BackdropDamaged(VRect Aera) override {
+		VRect Damage = Aera.Intersect(ObjectRect());
+
+		if (Damage.IsEmpty() == true) {
+			return;
+		}
+
+		if (PendingDamage.IsEmpty() == true) {
+			PendingDamage = Damage;
+		}
+		else {
+			PendingDamage.FusionRect(Damage);
+		}
+
+		++DamageGeneration;
 	}
 
 	void OnPaint(VCanvas* Canvas) override {
-		VImage BackgroundImage(GetWidth(), GetHeight());
+		if (UpdateBlurCache() == false) {
+			BlurredBackdrop.reset(new VImage(GetWidth(), GetHeight()));
 
-		for (int Y = GetY(), SY = 0; Y < Surface()->Rect.bottom; ++Y, ++SY) {
-			for (int X = GetX(), SX = 0; X < Surface()->Rect.right; ++X, ++SX) {
-				BackgroundImage.SetPixel(SX, SY, GetParentCanvas()->GetPixel(X, Y));
+			for (int Y = GetY(), SY = 0; Y < ObjectRect().bottom; ++Y, ++SY) {
+				for (int X = GetX(), SX = 0; X < ObjectRect().right; ++X, ++SX) {
+					BlurredBackdrop->SetPixel(SX, SY, GetParentCanvas()->GetPixel(X, Y));
+				}
 			}
-		}
 
-		BackgroundImage.ApplyBlurEffect(Theme->BlurRadius);
+			BlurredBackdrop->ApplyBlurEffect(Theme->BlurRadius);
+
+			/* Not a Cache, the Next Paint Tries Again */
+			CacheBlurRadius = -1;
+		}
 
 		VPainterDevice Device(Canvas);
-		VTextureBrush  Brush(BackgroundImage);
+		VTextureBrush  Brush(BlurredBackdrop.get());
 		VSolidBrush    MixBrusher(Theme->MixedColor);
 
 		Device.SolidRoundedRectangle(&Brush      , { 0, 0, GetWidth(), GetHeight() }, Theme->Radius);
@@ -50,7 +246,7 @@ public:
 	 *	@description  : Get the Blur Radius
 	 */
 	void SetBlurRadius(int Radius) {
-		Theme->BlurRadius = Radius;
+		Theme.Edit()->BlurRadius = Radius;
 
 		UpdateObject();
 	}
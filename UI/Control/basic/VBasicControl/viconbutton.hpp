@@ -17,7 +17,7 @@ VLIB_BEGIN_NAMESPACE
 */
 class VIconButton : public VAbstractButton {
 private:
-	VIconButtonTheme* Theme;
+	VThemeHandle<VIconButtonTheme> Theme;
 
 	VColorInterpolator TextColor;
 	VColorInterpolator BackgroundColor;
@@ -29,10 +29,10 @@ public:
 	*/
 
 	VIconButton(VUIObject* Parent) : VAbstractButton(Parent),
-		TextColor(0.1, VInterpolatorType::AccelerateInterpolator),
-		BackgroundColor(0.1, VInterpolatorType::AccelerateInterpolator),
-		LineColor(0.1, VInterpolatorType::AccelerateInterpolator) {
-		Theme = new VIconButtonTheme(*(static_cast<VIconButtonTheme*>(SearchThemeFromParent(VICONBUTTON_THEME))));
+		TextColor(160, VInterpolatorType::AccelerateInterpolator),
+		BackgroundColor(160, VInterpolatorType::AccelerateInterpolator),
+		LineColor(160, VInterpolatorType::AccelerateInterpolator) {
+		Theme = GetThemeHandle<VIconButtonTheme>(VICONBUTTON_THEME);
 
 		if (VUnlikely(Theme == nullptr)) {
 			VAssertBox(L"Error! Can't Get the Native Theme Of VPushButton");
@@ -61,22 +61,30 @@ public:
 		TextColor.Start(Theme->CurrentTextColor, Theme->OnClickedTextColor);
 		LineColor.Start(Theme->CurrentLineColor, Theme->OnClickedLineColor);
 
+		StartAnimationTick();
+
 		ButtonPushed.Emit();
 	}
 	void LeftClickedUp() override {
 		BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->OnHoverBackgroundColor);
 		TextColor.Start(Theme->CurrentTextColor, Theme->OnHoverTextColor);
 		LineColor.Start(Theme->CurrentLineColor, Theme->OnHoverLineColor);
+
+		StartAnimationTick();
 	}
 	void GotMouseFocus() override {
 		BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->OnHoverBackgroundColor);
 		TextColor.Start(Theme->CurrentTextColor, Theme->OnHoverTextColor);
 		LineColor.Start(Theme->CurrentLineColor, Theme->OnHoverLineColor);
+
+		StartAnimationTick();
 	}
 	void LosedMouseFocus() override {
 		BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->BackgroundColor);
 		TextColor.Start(Theme->CurrentTextColor, Theme->TextColor);
 		LineColor.Start(Theme->CurrentLineColor, Theme->LineColor);
+
+		StartAnimationTick();
 	}
 
 public:
@@ -85,19 +93,25 @@ public:
 	 *	@description  : Set the Button's Icon
 	*/
 	void SetIcon(VImage* Icon) {
-		Theme->IconImage = Icon;
+		Theme.Edit()->IconImage = Icon;
 	}
 
-	void CheckFrame() override {
+	bool TickAnimation() override {
 		if (BackgroundColor.IsAnimationEnd() == false ||
 			TextColor.IsAnimationEnd() == false ||
 			LineColor.IsAnimationEnd() == false) {
-			Theme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
-			Theme->CurrentTextColor = TextColor.GetOneFrame();
-			Theme->CurrentLineColor = LineColor.GetOneFrame();
+			VIconButtonTheme* AnimatedTheme = Theme.Edit();
+
+			AnimatedTheme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
+			AnimatedTheme->CurrentTextColor = TextColor.GetOneFrame();
+			AnimatedTheme->CurrentLineColor = LineColor.GetOneFrame();
 
 			Update();
+
+			return true;
 		}
+
+		return false;
 	}
 };
 
@@ -15,13 +15,24 @@ VLIB_BEGIN_NAMESPACE
 */
 class VImageLabel : public VUIObject {
 public:
-	VImageLabelTheme* Theme;
+	VThemeHandle<VImageLabelTheme> Theme;
 
 public:
 	VImageLabel(VImage* Image, VUIObject* Parent) : VUIObject(Parent) {
-		Theme = new VImageLabelTheme(*(static_cast<VImageLabelTheme*>(SearchThemeFromParent(VIMAGELABEL_THEME))));
+		Theme = GetThemeHandle<VImageLabelTheme>(VIMAGELABEL_THEME);
 
-		Theme->Image = Image;
+		if (Image != nullptr) {
+			Theme.Edit()->Image = Image;
+		}
+	}
+
+	/*
+	 * IsContentOpaque override Functional:
+	 *	@description  : An Image Without Alpha Drawn 1:1 Covers the Whole Label
+	*/
+	bool IsContentOpaque() override {
+		return Theme->Image != nullptr && Theme->Image->GetWidth() == GetWidth() && Theme->Image->GetHeight() == GetHeight() &&
+			Theme->Image->IsOpaque() == true;
 	}
 
 	void OnPaint(VCanvas* Canvas) override {
@@ -37,7 +48,7 @@ public:
 	 *	@description  : Set the Image
 	*/
 	void SetImage(VImage* Image) {
-		Theme->Image = Image;
+		Theme.Edit()->Image = Image;
 
 		UpdateObject();
 	}
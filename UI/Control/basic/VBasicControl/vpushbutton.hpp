@@ -17,7 +17,7 @@ VLIB_BEGIN_NAMESPACE
 */
 class VPushButton : public VAbstractButton {
 private:
-	VPushButtonTheme* Theme;
+	VThemeHandle<VPushButtonTheme> Theme;
 
 	VColorInterpolator TextColor;
 	VColorInterpolator BackgroundColor;
@@ -29,15 +29,19 @@ public:
 	*/
 
 	VPushButton(VUIObject* Parent, std::wstring PlaneString = L"") : VAbstractButton(Parent),
-		TextColor(0.1, VInterpolatorType::AccelerateInterpolator),
-		BackgroundColor(0.1, VInterpolatorType::AccelerateInterpolator),
-		LineColor(0.1, VInterpolatorType::AccelerateInterpolator) {
-		Theme = new VPushButtonTheme(*(static_cast<VPushButtonTheme*>(SearchThemeFromParent(VPUSHBUTTON_THEME))));
-		Theme->PlaneString = PlaneString;
+		TextColor(160, VInterpolatorType::AccelerateInterpolator),
+		BackgroundColor(160, VInterpolatorType::AccelerateInterpolator),
+		LineColor(160, VInterpolatorType::AccelerateInterpolator) {
+		Theme = GetThemeHandle<VPushButtonTheme>(VPUSHBUTTON_THEME);
 
 		if (VUnlikely(Theme == nullptr)) {
 			VAssertBox(L"Error! Can't Get the Native Theme Of VPushButton");
 		}
+
+		/* Keep Sharing the Native Theme Until Something Differs */
+		if (PlaneString.empty() == false) {
+			Theme.Edit()->PlaneString = PlaneString;
+		}
 	}
 
 	/*
@@ -55,29 +59,49 @@ public:
 
 		VPainterDevice Device(Canvas);
 
+		/* The Rounded Fill Is Inset By the Pen, an Opaque Button Must Still Cover Its Edge */
+		if (IsContentOpaque() == true) {
+			Device.SolidRectangle(&FillBrush, GetSourceRect());
+		}
+
 		Device.FillRoundedRectangle(&BorderPen, &FillBrush, GetSourceRect(), Theme->Radius);
 		Device.DrawString(Theme->PlaneString, &Font, &PenBrush, &FontFormat, GetSourceRect());
 	}
+	/*
+	 * IsContentOpaque override Functional:
+	 *	@description  : A Solid, Square Cornered Background Covers the Whole Button ( Follows the Color Animation )
+	*/
+	bool IsContentOpaque() override {
+		return Theme->CurrentBackgroundColor.GetAlpha() == 255 && Theme->Radius.x == 0 && Theme->Radius.y == 0;
+	}
 
 	void LeftClickedDown() override {
 		BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->OnClickedBackgroundColor);
 		TextColor.Start(Theme->CurrentTextColor, Theme->OnClickedTextColor);
 		LineColor.Start(Theme->CurrentLineColor, Theme->OnClickedLineColor);
+
+		StartAnimationTick();
 	}
 	void LeftClickedUp() override {
 		BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->OnHoverBackgroundColor);
 		TextColor.Start(Theme->CurrentTextColor, Theme->OnHoverTextColor);
 		LineColor.Start(Theme->CurrentLineColor, Theme->OnHoverLineColor);
+
+		StartAnimationTick();
 	}
 	void GotMouseFocus() override {
 		BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->OnHoverBackgroundColor);
 		TextColor.Start(Theme->CurrentTextColor, Theme->OnHoverTextColor);
 		LineColor.Start(Theme->CurrentLineColor, Theme->OnHoverLineColor);
+
+		StartAnimationTick();
 	}
 	void LosedMouseFocus() override {
 		BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->BackgroundColor);
 		TextColor.Start(Theme->CurrentTextColor, Theme->TextColor);
 		LineColor.Start(Theme->CurrentLineColor, Theme->LineColor);
+
+		StartAnimationTick();
 	}
 
 public:
@@ -86,19 +110,25 @@ public:
 	 *	@description  : Set the Button's Plane Text
 	*/
 	void SetPlaneText(std::wstring PlaneText) {
-		Theme->PlaneString = PlaneText;
+		Theme.Edit()->PlaneString = PlaneText;
 	}
 
-	void CheckFrame() override {
+	bool TickAnimation() override {
 		if (BackgroundColor.IsAnimationEnd() == false ||
 			TextColor.IsAnimationEnd() == false ||
 			LineColor.IsAnimationEnd() == false) {
-			Theme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
-			Theme->CurrentTextColor = TextColor.GetOneFrame();
-			Theme->CurrentLineColor = LineColor.GetOneFrame();
+			VPushButtonTheme* AnimatedTheme = Theme.Edit();
+
+			AnimatedTheme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
+			AnimatedTheme->CurrentTextColor = TextColor.GetOneFrame();
+			AnimatedTheme->CurrentLineColor = LineColor.GetOneFrame();
 
 			Update();
+
+			return true;
 		}
+
+		return false;
 	}
 };
 
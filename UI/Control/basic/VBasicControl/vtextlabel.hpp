@@ -16,7 +16,7 @@ VLIB_BEGIN_NAMESPACE
 */
 class VTextLabel : public VUIObject {
 private:
-	VTextLabelTheme* Theme;
+	VThemeHandle<VTextLabelTheme> Theme;
 
 public:
 	/*
@@ -25,9 +25,11 @@ public:
 
 	VTextLabel(VUIObject* Parent, std::wstring Text)
 		: VUIObject(Parent) {
-		Theme = new VTextLabelTheme(*(static_cast<VTextLabelTheme*>(SearchThemeFromParent(VTEXTLABEL_THEME))));
+		Theme = GetThemeHandle<VTextLabelTheme>(VTEXTLABEL_THEME);
 
-		Theme->PlaneString = Text;
+		if (Text.empty() == false) {
+			Theme.Edit()->PlaneString = Text;
+		}
 	}
 
 	/*
@@ -42,56 +44,68 @@ public:
 
 		VPainterDevice Device(Canvas);
 
+		/* The Rounded Fill Is Inset By the Pen, an Opaque Label Must Still Cover Its Edge */
+		if (IsContentOpaque() == true) {
+			Device.SolidRectangle(&FillBrush, GetSourceRect());
+		}
+
 		Device.FillRoundedRectangle(&BorderPen, &FillBrush, GetSourceRect(), Theme->Radius);
 		Device.DrawString(Theme->PlaneString, &Font, &PenBrush, Theme->FontFormat, GetSourceRect());
 	}
+	/*
+	 * IsContentOpaque override Functional:
+	 *	@description  : A Solid, Square Cornered Background Covers the Whole Label
+	*/
+	bool IsContentOpaque() override {
+		return Theme->BackgroundColor.GetAlpha() == 255 && Theme->Radius.x == 0 && Theme->Radius.y == 0;
+	}
 
 	/*
 	 * SetPlaneText Functional:
 	 *	@description  : Set the Text Label Text
 	*/
 	void SetPlaneText(std::wstring Text) {
-		Theme->PlaneString = Text;
+		Theme.Edit()->PlaneString = Text;
 
 		UpdateObject();
 	}
 
 
 	void SetLineAlignment(VStringAlignment Alignment) {
-		Theme->FontFormat->SetLineAlignment(Alignment);
+		Theme.Edit()->FontFormat->SetLineAlignment(Alignment);
 
 		UpdateObject();
 	}
 	void SetAlignment(VStringAlignment Alignment) {
-		Theme->FontFormat->SetAlignment(Alignment);
+		Theme.Edit()->FontFormat->SetAlignment(Alignment);
 
 		UpdateObject();
 	}
 
 	void SetTextSize(int TextSize) {
-		Theme->FontSize = TextSize;
+		Theme.Edit()->FontSize = TextSize;
 
 		UpdateObject();
 	}
 
 	void SetBackgroundColor(VColor Color) {
-		Theme->BackgroundColor = Color;
+		Theme.Edit()->BackgroundColor = Color;
 
 		UpdateObject();
 	}
 	void SetLineColor(VColor Color) {
-		Theme->LineColor = Color;
+		Theme.Edit()->LineColor = Color;
 
 		UpdateObject();
 	}
 	void SetTextColor(VColor Color) {
-		Theme->TextColor = Color;
+		Theme.Edit()->TextColor = Color;
 
 		UpdateObject();
 	}
 
 	void SetRadius(VPoint Radius) {
-		Theme->Radius = Radius;
+		Theme.Edit()->Radius = Radius;
 
 		UpdateObject();
 	}
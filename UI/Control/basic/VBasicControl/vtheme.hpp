@@ -9,6 +9,9 @@
 #include "../../../basic/vbasic/vbase.hpp"
 #include "../../../render/vrender/vpainter.hpp"
 
+#include <memory>
+#include <vector>
+
 VLIB_BEGIN_NAMESPACE
 
 #define UNKNOW_THEME_TYPE 0
@@ -26,6 +29,9 @@ public:
 	VTheme() {
 
 	}
+	virtual ~VTheme() {
+
+	}
 
 public:
 	/*
@@ -121,6 +127,27 @@ public:
 	VFontFormat* FontFormat;
 
 public:
+	/*
+	 * The Font Format Is Owned By Each Theme Copy ( Deep Copied )
+	*/
+	VTextLabelTheme(const VTextLabelTheme& Theme)
+		: VNativeLabelTheme(Theme) {
+		FontFormat = new VFontFormat(*Theme.FontFormat);
+	}
+	VTextLabelTheme& operator=(const VTextLabelTheme& Theme) {
+		if (this != &Theme) {
+			VNativeLabelTheme::operator=(Theme);
+
+			delete FontFormat;
+			FontFormat = new VFontFormat(*Theme.FontFormat);
+		}
+
+		return *this;
+	}
+	~VTextLabelTheme() override {
+		delete FontFormat;
+	}
+
 	VTextLabelTheme() {
 		TextColor = VColor(255, 255, 255, 119);
 		BackgroundColor = VColor(0, 0, 0, 0);
@@ -315,4 +342,115 @@ public:
 	}
 };
 
-VLIB_END_NAMESPACE
\ No newline at end of file
+/*
+ * VThemeRegistry class:
+ *	@description  : The Application-wide Themes Indexed By Theme Type, Every Control Shares
+ *					the Registered Instance Until It Changes Something ( See VThemeHandle )
+*/
+class VThemeRegistry {
+private:
+	std::vector<std::shared_ptr<VTheme>> Themes;
+
+public:
+	/*
+	 * Instance Functional:
+	 *	@description  : Get the Global Registry
+	*/
+	static VThemeRegistry& Instance() {
+		static VThemeRegistry GlobalRegistry;
+
+		return GlobalRegistry;
+	}
+
+	/*
+	 * Register Functional:
+	 *	@description  : Register a Theme ( Replace the Old One Of Same Type ), the Registry Takes the Ownership,
+	 *					Controls Created Before Keep Using the Old One
+	*/
+	void Register(VTheme* Theme) {
+		size_t ThemeType = static_cast<size_t>(Theme->GetThemeType());
+
+		if (ThemeType >= Themes.size()) {
+			Themes.resize(ThemeType + 1);
+		}
+
+		Themes[ThemeType].reset(Theme);
+	}
+
+	/*
+	 * Get Functional:
+	 *	@description  : Get the Shared Theme Of a Type
+	 *	@return value : The Theme, nullptr If Not Registered
+	*/
+	std::shared_ptr<VTheme> Get(int ThemeType) const {
+		if (ThemeType < 0 || static_cast<size_t>(ThemeType) >= Themes.size()) {
+			return nullptr;
+		}
+
+		return Themes[ThemeType];
+	}
+};
+
+/*
+ * VThemeHandle class:
+ *	@description  : A Control's Reference To Its Theme, Reading Goes To the Shared Instance,
+ *					the First Edit Copies It ( Copy-on-write ) So Other Controls Are Not Affected
+*/
+template<class _Theme>
+class VThemeHandle {
+private:
+	std::shared_ptr<_Theme> Theme;
+
+public:
+	/*
+	 * Build up Functional
+	*/
+
+	VThemeHandle() {
+
+	}
+	explicit VThemeHandle(std::shared_ptr<_Theme> SharedTheme)
+		: Theme(std::move(SharedTheme)) {
+
+	}
+
+	/*
+	 * operator-> :
+	 *	@description  : Read the Theme
+	*/
+	const _Theme* operator->() const {
+		return Theme.get();
+	}
+	const _Theme* Get() const {
+		return Theme.get();
+	}
+
+	/*
+	 * Edit Functional:
+	 *	@description  : Get a Writable Theme Which Only This Handle Owns
+	*/
+	_Theme* Edit() {
+		if (Theme.use_count() > 1) {
+			Theme = std::make_shared<_Theme>(*Theme);
+		}
+
+		return Theme.get();
+	}
+
+	/*
+	 * IsShared Functional:
+	 *	@description  : Is the Theme Still Shared With Others
+	*/
+	bool IsShared() const {
+		return Theme.use_count() > 1;
+	}
+
+	bool operator==(std::nullptr_t) const {
+		return Theme == nullptr;
+	}
+	bool operator!=(std::nullptr_t) const {
+		return Theme != nullptr;
+	}
+};
+
+VLIB_END_NAMESPACE
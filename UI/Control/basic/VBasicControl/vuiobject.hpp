@@ -7,11 +7,19 @@
 #pragma once
 
 #include "../../../render/vrender/vpainter.hpp"
+#include "../../../render/vrender/vdisplaylist.hpp"
 #include "../../../basic/vbasic/vmessage.hpp"
 #include "../../../basic/vbasic/vsignal.hpp"
+#include "../../../basic/vbasic/vprofiler.hpp"
+#include "../../../basic/vbasic/vspatialgrid.hpp"
+#include "../../../basic/vbasic/vhandle.hpp"
 
 #include "vtheme.hpp"
+#include "vuiobjectstore.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <typeinfo>
 #include <vector>
 
 VLIB_BEGIN_NAMESPACE
@@ -19,40 +27,139 @@ VLIB_BEGIN_NAMESPACE
 /* Pre-Declared VUIObject FOr VUIObjectKernel */
 class VUIObject;
 
+/* Resolve Object Handles To the Living Objects */
+VHandleTable<VUIObject> _VL_Object_Handle_Table;
+/* Every Object's Geometry And Stats, Indexed By Handle Index */
+VUIObjectStore          _VL_Object_Store;
+
 /*
- * VUIObjectKernel class:
- *	@description  : This Class Describe a Object Kernel Attribute
+ * VAnimationStatistics struct:
+ *	@description  : How Smooth the Animations Ran
 */
-struct VUIObjectKernel {
-	/* Object's Parent */
-	VUIObject* Parent = nullptr;
-
-	/* Object's Parent ID ( Vector Position ) */
-	size_t	     ParentID = 0;
-	/* Object's Global ID */
-	std::wstring GlobalID = L"VO";
-
-	/* Object's Child Object */
-	std::vector<VUIObject* > ChildObjectContainer;
+struct VAnimationStatistics {
+	/* How Many Frames Ticked Animations */
+	unsigned long long FrameCount = 0;
+	/* How Many Frame Slots Were Skipped Between Two Animation Ticks */
+	unsigned long long DroppedFrameCount = 0;
 };
 
 /*
- * VUIObjectUIStats
+ * VAnimationRegistry class:
+ *	@description  : The Objects Which Are Animating, Only They Are Ticked Each Frame
+ *					( Deleted Objects Leave By Their Handles Going Stale )
 */
-enum VUIObjectUIStats {
-	Hidden, OnClicked, OnFocus, Normal
+class VAnimationRegistry {
+private:
+	std::vector<VObjectHandle> Running;
+	std::vector<VObjectHandle> Ticking;
+
+	/* The Frame Time Of the Last Tick, -1 When Nothing Was Animating */
+	long long                  LastTickTime = -1;
+	VAnimationStatistics       Statistics;
+
+public:
+	/*
+	 * Join Functional:
+	 *	@description  : Let the Object Be Ticked From Next Frame
+	*/
+	void Join(VObjectHandle Handle) {
+		if (std::find(Running.begin(), Running.end(), Handle) == Running.end()) {
+			Running.push_back(Handle);
+		}
+	}
+	/*
+	 * IsEmpty Functional:
+	 *	@description  : Is Nothing Animating
+	*/
+	bool IsEmpty() const {
+		return Running.empty();
+	}
+	/*
+	 * Tick Functional:
+	 *	@description  : Tick Every Running Object Once In One Pass ( All Of Them Sample the Same Frame Time ),
+	 *					Objects Whose Ticker Returns false Leave
+	*/
+	template<class _Ticker>
+	void Tick(_Ticker Ticker, long long FrameTime, long long FrameInterval) {
+		if (Running.empty() == true) {
+			LastTickTime = -1;
+
+			return;
+		}
+
+		/* A Gap Of N Intervals Since the Last Tick Means N - 1 Frames Were Skipped */
+		if (LastTickTime >= 0 && FrameInterval > 0) {
+			long long Skipped = (FrameTime - LastTickTime + FrameInterval / 2) / FrameInterval - 1;
+
+			if (Skipped > 0) {
+				Statistics.DroppedFrameCount += Skipped;
+			}
+		}
+
+		++Statistics.FrameCount;
+
+		Ticking.clear();
+		Ticking.swap(Running);
+
+		for (auto Handle : Ticking) {
+			if (Ticker(Handle) == true) {
+				Join(Handle);
+			}
+		}
+
+		LastTickTime = Running.empty() == true ? -1 : FrameTime;
+	}
+
+	/*
+	 * GetStatistics Functional:
+	 *	@description  : Get the Animation Statistics
+	*/
+	const VAnimationStatistics& GetStatistics() const {
+		return Statistics;
+	}
+	/*
+	 * ResetStatistics Functional:
+	 *	@description  : Clear the Animation Statistics
+	*/
+	void ResetStatistics() {
+		Statistics = VAnimationStatistics();
+	}
 };
 
+VAnimationRegistry      _VL_Animation_Registry;
+
 /*
- * VUIObjectSurface class:
- *	@description  : This Class Desribe A Object's Surface Stats
+ * VUIObjectKernel class:
+ *	@description  : This Class Describe a Object Kernel Attribute
 */
-struct VUIObjectSurface {
-	VRect			 Rect;
-
-	int              Transparency = 255;
+struct VUIObjectKernel {
+	/* Object's Parent */
+	VUIObject* Parent = nullptr;
 
-	VUIObjectUIStats UIStats = VUIObjectUIStats::Normal;
+	/* Object's Z-Order Among Siblings ( Bigger Is Closer To the Top ) */
+	long long     ZOrder = 0;
+	/* Object's Global Handle ( Stable For the Object's Whole Life ) */
+	VObjectHandle Handle;
+
+	/* Object's Siblings ( Intrusive List In Paint Order, Bottom First ) */
+	VUIObject*    PrevSibling = nullptr;
+	VUIObject*    NextSibling = nullptr;
+
+	/* Object's Child Objects */
+	VUIObject*    FirstChild  = nullptr;
+	VUIObject*    LastChild   = nullptr;
+	size_t        ChildCount  = 0;
+
+	/* The Z-Order Bounds Of the Children, Raising Or Lowering a Child Only Extends Them */
+	long long     TopZOrder    = 0;
+	long long     BottomZOrder = 0;
+
+	/* The Visible Children Indexed By Rect ( For Mouse Hit Testing ) */
+	VSpatialGrid<VUIObject>  ChildHitIndex;
+	/* The Children Which Own Mouse Focus ( They Must Receive Mouse Messages To Lose It ) */
+	std::vector<VUIObject* > MouseFocusedChild;
+	/* The Hit Candidates Buffer Of Mouse Dispatch, Kept So the Input Path Does Not Allocate */
+	std::vector<VUIObject* > MouseCandidates;
 };
 
 /*
@@ -61,20 +168,6 @@ struct VUIObjectSurface {
 */
 class VUIObject {
 protected:
-	/*
-	 * GetThemeListFromParent virtual Functional:
-	 *	@description  : Get the Theme List From Application Parent
-	*/
-	virtual std::vector<VTheme*> GetThemeListFromParent() {
-		if (VUnlikely(Parent() != nullptr)) {
-			return Parent()->GetThemeListFromParent();
-		}
-		else {
-			VAssertBox(L"Parent() Should Not Be Nullptr!");
-
-			return std::vector<VTheme*>(0);
-		}
-	}
 	/*
 	 * GetRegoin Functional:
 	 *	@description  : Get the Regoin of Object
@@ -90,6 +183,14 @@ public:
 	*/
 	VCanvas* ObjectCanvas = nullptr;
 
+	/*
+	 * ContentDirty & CanvasTransparency Variable:
+	 *	@description  : ObjectCanvas Is Kept Between Frames As the Object's Layer, Only a Content
+	 *					Change Paints It Again, Moving And Fading Only Composite It
+	*/
+	bool     ContentDirty       = true;
+	short    CanvasTransparency = 255;
+
 	/*
 	 * GetParentCanvas Functional:
 	 *	@description  : Get Parent Canvas
@@ -99,63 +200,97 @@ public:
 	}
 
 	/*
-	 * SearchThemeFromParent Functional:
-	 *	@description  : Search Theme From Parent
+	 * GetDisplayList virtual Functional:
+	 *	@description  : Get the Display List Which Records Children's Composition Into ObjectCanvas,
+	 *					nullptr Means Children Paint Into ObjectCanvas Directly
 	*/
-	VTheme* SearchThemeFromParent(int ThemeID) {
-		auto ThemeList = GetThemeListFromParent();
-
-		for (auto& ThemeObject : ThemeList) {
-			if (ThemeObject->GetThemeType() == ThemeID) {
-				return ThemeObject;
-			}
-		}
-
+	virtual VDisplayList* GetDisplayList() {
 		return nullptr;
 	}
+	/*
+	 * ReadsBackdrop virtual Functional:
+	 *	@description  : Does the Object Read Parent Canvas In OnPaint ( Pending Compositions Will Be Flushed First )
+	*/
+	virtual bool ReadsBackdrop() {
+		return false;
+	}
+	/*
+	 * BackdropDamaged virtual Functional:
+	 *	@description  : Backdrop Readers Are Told Each Damage As Reported, Before It Is Fused With Them
+	*/
+	virtual void BackdropDamaged(VRect Aera) {
+		/* Empty */
+	}
 
-private:
 	/*
-	 * Generated Functional:
-	 *	@description  : This Function Generated A Global ID For Local Object
+	 * GetProfileDetail Functional:
+	 *	@description  : Write "TypeName:HandleIndex" For Tagging Profile Zones
 	*/
-	std::wstring GeneratedGlobalID(std::wstring LocalID = L"") {
-		if (ObjectKernel->Parent->IsApplication() == false) {
-			LocalID += std::to_wstring(ObjectKernel->ParentID);
+	void GetProfileDetail(char* Buffer, size_t BufferSize) {
+		const char* TypeName = typeid(*this).name();
+
+		/* Drop the "class " Prefix And Namespace */
+		for (const char* Character = TypeName; *Character != '\0'; ++Character) {
+			if (*Character == ' ' || *Character == ':') {
+				TypeName = Character + 1;
+			}
+		}
 
-			return ObjectKernel->Parent->GeneratedGlobalID(LocalID);
+		size_t Length = 0;
+		for (; *TypeName != '\0' && Length + 1 < BufferSize; ++TypeName, ++Length) {
+			Buffer[Length] = *TypeName;
 		}
 
-		return LocalID;
+		Buffer[Length] = '\0';
+
+		if (Length + 1 < BufferSize) {
+			snprintf(Buffer + Length, BufferSize - Length, ":%u", ObjectKernel.Handle.Index);
+		}
+	}
+
+	/*
+	 * SearchThemeFromParent Functional:
+	 *	@description  : Get the Registered Theme By ID ( O(1), No Copy )
+	*/
+	VTheme* SearchThemeFromParent(int ThemeID) {
+		return VThemeRegistry::Instance().Get(ThemeID).get();
+	}
+	/*
+	 * GetThemeHandle Functional:
+	 *	@description  : Get a Copy-on-write Handle To the Registered Theme
+	*/
+	template<class _Theme>
+	VThemeHandle<_Theme> GetThemeHandle(int ThemeID) {
+		return VThemeHandle<_Theme>(std::static_pointer_cast<_Theme>(VThemeRegistry::Instance().Get(ThemeID)));
 	}
 
 protected:
 	/*
 	 * SetGlobalFocusID Functional:
-	 *	@description  : Set the Global Focus Object's ID
+	 *	@description  : Set the Global Focus Object's Handle
 	*/
-	virtual void        SetGlobalFocusID(std::wstring ObjectID) {
+	virtual void        SetGlobalFocusID(VObjectHandle ObjectID) {
 		if (Parent() != nullptr) {
 			Parent()->SetGlobalFocusID(ObjectID);
 		}
 	}
 	/*
 	 * GetGlobalFocusID Functional:
-	 *	@description  : Get the Global Focus Object's ID
-	 *	@return value : ID
+	 *	@description  : Get the Global Focus Object's Handle
+	 *	@return value : Handle ( Invalid If No Object Owns Focus )
 	*/
-	virtual std::wstring GetGlobalFocusID() {
+	virtual VObjectHandle GetGlobalFocusID() {
 		if (Parent() != nullptr) {
 			return Parent()->GetGlobalFocusID();
 		}
 
-		return L"";
+		return VObjectHandle();
 	}
 	/*
 	 * LockGlobalFocusID Functional:
 	 *	@description  : Lock the Global Focus Object
 	*/
-	virtual void LockGlobalFocusID(std::wstring ID) {
+	virtual void LockGlobalFocusID(VObjectHandle ID) {
 		if (Parent() != nullptr) {
 			return Parent()->LockGlobalFocusID(ID);
 		}
@@ -177,6 +312,8 @@ protected:
 		if (Parent() != nullptr) {
 			return Parent()->IsGlobalIDLocking();
 		}
+
+		return false;
 	}
 
 protected:
@@ -192,18 +329,46 @@ protected:
 	 *	@description  : Get the Kernel Object
 	*/
 	VUIObjectKernel* Kernel() {
-		return ObjectKernel;
+		return &ObjectKernel;
 	}
 	/*
 	 * Parent Functional:
 	 *	@description  : Get the Parent Object
 	*/
 	VUIObject* Parent() {
-		return ObjectKernel->Parent;
+		return ObjectKernel.Parent;
+	}
+
+	/*
+	 * ObjectIndex Functional:
+	 *	@description  : Get the Object's Slot In the Object Store
+	*/
+	unsigned int      ObjectIndex() const {
+		return ObjectKernel.Handle.Index;
+	}
+	/*
+	 * ObjectRect Functional:
+	 *	@description  : Get the Object's Rect ( In Parent's Coordinate, a Copy From the Object Store )
+	*/
+	VRect             ObjectRect() const {
+		return _VL_Object_Store.Rect(ObjectIndex());
+	}
+	/*
+	 * SetObjectRect Functional:
+	 *	@description  : Store the Object's Rect ( Move And Resize Keep the Hit Index And Damage Up To Date )
+	*/
+	void              SetObjectRect(VRect Rect) {
+		_VL_Object_Store.SetRect(ObjectIndex(), Rect);
+	}
+	/*
+	 * GetUIStats & SetUIStats Functional:
+	 *	@description  : The Object's UI Stats
+	*/
+	VUIObjectUIStats  GetUIStats() const {
+		return _VL_Object_Store.Stats(ObjectIndex());
 	}
-	/* Get UI Surface */
-	VUIObjectSurface* Surface() {
-		return ObjectSurface;
+	void              SetUIStats(VUIObjectUIStats Stats) {
+		_VL_Object_Store.SetStats(ObjectIndex(), Stats);
 	}
 	/*
 	 * SendMessageToChild Functional:
@@ -236,10 +401,16 @@ protected:
 
 		bool Flag = false;
 
+		if ((Message->GetType() == VMessageType::MouseMoveMessage ||
+			Message->GetType() == VMessageType::MouseClickedMessage) && IsApplication() == false) {
+			return SendMouseMessageToChild(static_cast<VMessage*>(Message), BreakWhenMeetTrue);
+		}
+
 		if (Message->GetType() != VMessageType::RepaintMessage) {
-			for (auto ChildObject = Kernel()->ChildObjectContainer.rbegin();
-				ChildObject != Kernel()->ChildObjectContainer.rend(); ++ChildObject) {
-				if (ChildObject.operator*()->SysDealyMessage(Message) == true) {
+			for (VUIObject* ChildObject = Kernel()->LastChild; ChildObject != nullptr;) {
+				VUIObject* PrevObject = ChildObject->Kernel()->PrevSibling;
+
+				if (ChildObject->SysDealyMessage(Message) == true) {
 					if (BreakWhenMeetTrue == true) {
 						return true;
 					}
@@ -247,12 +418,56 @@ protected:
 						Flag = true;
 					}
 				}
+
+				ChildObject = PrevObject;
 			}
 		}
 		else {
-			for (auto ChildObject = Kernel()->ChildObjectContainer.begin();
-				ChildObject != Kernel()->ChildObjectContainer.end(); ++ChildObject) {
-				if (ChildObject.operator*()->SysDealyMessage(Message) == true) {
+			auto RepaintMessage = static_cast<VRepaintMessage*>(Message);
+
+			/* Gather the Children's Store Indices In Paint Order */
+			std::vector<VUIObject*>    ChildObjects;
+			std::vector<unsigned int>  ChildIndices;
+
+			ChildObjects.reserve(Kernel()->ChildCount);
+			ChildIndices.reserve(Kernel()->ChildCount);
+
+			for (VUIObject* ChildObject = Kernel()->FirstChild; ChildObject != nullptr; ChildObject = ChildObject->Kernel()->NextSibling) {
+				ChildObjects.push_back(ChildObject);
+				ChildIndices.push_back(ChildObject->ObjectIndex());
+			}
+
+			/* Only the Visible Children Overlapping the Damage Need Painting */
+			std::vector<unsigned char> ObjectDamaged;
+			std::vector<VRect>         OpaqueCover;
+
+			_VL_Object_Store.QueryOverlap(ChildIndices.data(), ChildIndices.size(), RepaintMessage->DirtyRectangle, ObjectDamaged);
+
+			/* Front-to-back Culling Pass : Drop the Objects Hidden By Opaque Objects Above Them */
+			for (size_t Count = ChildIndices.size(); Count > 0; --Count) {
+				if (ObjectDamaged[Count - 1] == 0) {
+					continue;
+				}
+
+				VRect ChildRect = _VL_Object_Store.Rect(ChildIndices[Count - 1]);
+
+				if (IsAeraOccluded(RepaintMessage->DirtyRectangle.Intersect(ChildRect), OpaqueCover) == true) {
+					ObjectDamaged[Count - 1] = 0;
+
+					continue;
+				}
+
+				if (ChildObjects[Count - 1]->IsOpaque() == true) {
+					OpaqueCover.push_back(ChildRect);
+				}
+			}
+
+			for (size_t Count = 0; Count < ChildObjects.size(); ++Count) {
+				if (ObjectDamaged[Count] == 0) {
+					continue;
+				}
+
+				if (ChildObjects[Count]->SysDealyMessage(Message) == true) {
 					if (BreakWhenMeetTrue == true) {
 						return true;
 					}
@@ -266,6 +481,153 @@ protected:
 		return Flag;
 	}
 
+	/*
+	 * SendMouseMessageToChild Functional:
+	 *	@description  : Only Send the Mouse Message To Children Under the Mouse ( Hit Index ),
+	 *					the Children Which Own Mouse Focus And the Child Leading To the Focus
+	 *					Lock Holder ( a Drag Goes On Outside Its Rect ), Top-most First
+	 *	@return value : Children Take Over Message Or Not
+	*/
+	bool SendMouseMessageToChild(VMessage* Message, bool BreakWhenMeetTrue) {
+		VPoint MousePosition = Message->GetType() == VMessageType::MouseMoveMessage ?
+			static_cast<VMouseMoveMessage*>(Message)->MousePosition :
+			static_cast<VMouseClickedMessage*>(Message)->MousePosition;
+
+		/* Borrow the Buffer, a Reentrant Dispatch To This Object Just Gets a Empty One */
+		std::vector<VUIObject*> Candidates;
+
+		Candidates.swap(Kernel()->MouseCandidates);
+		Candidates.clear();
+
+		Kernel()->ChildHitIndex.Query(MousePosition, Candidates);
+
+		for (auto ChildObject : Kernel()->MouseFocusedChild) {
+			if (std::find(Candidates.begin(), Candidates.end(), ChildObject) == Candidates.end()) {
+				Candidates.push_back(ChildObject);
+			}
+		}
+
+		VUIObject* LockedChild = GetFocusLockedChild();
+
+		if (LockedChild != nullptr &&
+			std::find(Candidates.begin(), Candidates.end(), LockedChild) == Candidates.end()) {
+			Candidates.push_back(LockedChild);
+		}
+
+		std::sort(Candidates.begin(), Candidates.end(), [](VUIObject* Left, VUIObject* Right) {
+			return Left->Kernel()->ZOrder > Right->Kernel()->ZOrder;
+		});
+
+		bool Flag = false;
+
+		for (auto ChildObject : Candidates) {
+			bool Result = ChildObject->SysDealyMessage(Message);
+
+			auto FocusedChild = std::find(Kernel()->MouseFocusedChild.begin(), Kernel()->MouseFocusedChild.end(), ChildObject);
+
+			if (ChildObject->GetUIStats() == VUIObjectUIStats::OnFocus) {
+				if (FocusedChild == Kernel()->MouseFocusedChild.end()) {
+					Kernel()->MouseFocusedChild.push_back(ChildObject);
+				}
+			}
+			else if (FocusedChild != Kernel()->MouseFocusedChild.end()) {
+				Kernel()->MouseFocusedChild.erase(FocusedChild);
+			}
+
+			if (Result == true) {
+				Flag = true;
+
+				if (BreakWhenMeetTrue == true) {
+					break;
+				}
+			}
+		}
+
+		Kernel()->MouseCandidates.swap(Candidates);
+
+		return Flag;
+	}
+
+	/*
+	 * GetFocusLockedChild Functional:
+	 *	@description  : Get the Child Which Holds the Global Focus Lock Or Contains Its Holder
+	 *	@return value : The Child, nullptr If the Lock Is Not Held Under This Object
+	*/
+	VUIObject* GetFocusLockedChild() {
+		if (IsGlobalIDLocking() == false) {
+			return nullptr;
+		}
+
+		VUIObject* LockedObject = FromHandle(GetGlobalFocusID());
+
+		while (LockedObject != nullptr && LockedObject->Parent() != this) {
+			LockedObject = LockedObject->Parent();
+		}
+
+		return LockedObject;
+	}
+
+	/*
+	 * UpdateHitIndex Functional:
+	 *	@description  : Keep This Object's Entry In Parent's Hit Index Up To Date
+	*/
+	void UpdateHitIndex() {
+		if (Parent() == nullptr) {
+			return;
+		}
+
+		if (GetUIStats() == VUIObjectUIStats::Hidden) {
+			Parent()->Kernel()->ChildHitIndex.Remove(this);
+		}
+		else {
+			Parent()->Kernel()->ChildHitIndex.Insert(this, ObjectRect());
+		}
+	}
+
+	/*
+	 * IsAeraOccluded Functional:
+	 *	@description  : Is the Aera Fully Covered By the Opaque Rects
+	*/
+	static bool       IsAeraOccluded(VRect Aera, const std::vector<VRect>& OpaqueCover) {
+		std::vector<VRect> VisibleAera{ Aera };
+
+		for (auto Cover : OpaqueCover) {
+			std::vector<VRect> RestAera;
+
+			for (auto& Visible : VisibleAera) {
+				VRect Common = Visible.Intersect(Cover);
+
+				if (Common.IsEmpty() == true) {
+					RestAera.push_back(Visible);
+
+					continue;
+				}
+
+				/* Split the Uncovered Part Into At Most Four Rects */
+				if (Visible.top < Common.top) {
+					RestAera.push_back({ Visible.left, Visible.top, Visible.right, Common.top });
+				}
+				if (Common.bottom < Visible.bottom) {
+					RestAera.push_back({ Visible.left, Common.bottom, Visible.right, Visible.bottom });
+				}
+				if (Visible.left < Common.left) {
+					RestAera.push_back({ Visible.left, Common.top, Common.left, Common.bottom });
+				}
+				if (Common.right < Visible.right) {
+					RestAera.push_back({ Common.right, Common.top, Visible.right, Common.bottom });
+				}
+			}
+
+			if (RestAera.empty() == true) {
+				return true;
+			}
+
+			VisibleAera.swap(RestAera);
+		}
+
+		return false;
+	}
+
 	/*
 	 * SendMessageGlobalWidget virtual Functional:
 	 *	@description  : Send The Global Widget Message
@@ -291,28 +653,30 @@ private:
 	 *	@description  : Get the Object's Surface Rect
 	*/
 	VRect SurfaceRect() {
-		return Surface()->Rect;
+		return ObjectRect();
 	}
 	/*
 	 * SurfaceRect Virtual Functional:
 	 *	@description  : Get the Object's Surface Regoin
 	*/
 	virtual VRect SurfaceRegion() {
-		return Surface()->Rect;
+		return ObjectRect();
 	}
 
 public:
 	void Show() {
-		if (Surface()->UIStats == VUIObjectUIStats::Hidden) {
-			Surface()->UIStats = VUIObjectUIStats::Normal;
+		if (GetUIStats() == VUIObjectUIStats::Hidden) {
+			SetUIStats(VUIObjectUIStats::Normal);
 
+			UpdateHitIndex();
 			UpdateObject();
 		}
 	}
 	void Hide() {
-		if (Surface()->UIStats != VUIObjectUIStats::Hidden) {
-			Surface()->UIStats = VUIObjectUIStats::Hidden;
+		if (GetUIStats() != VUIObjectUIStats::Hidden) {
+			SetUIStats(VUIObjectUIStats::Hidden);
 
+			UpdateHitIndex();
 			UpdateObject();
 		}
 	}
@@ -320,26 +684,34 @@ public:
 public:
 	/*
 	 * Update Functional:
-	 *	@description  : Send Repaint Requset To Parent Object
+	 *	@description  : Send Repaint Requset To Parent Object ( Composite Only, the Content Is Kept ),
+	 *					Every Ancestor's Layer Holds the Old Composition Of Its Children, So Each One
+	 *					On the Way Up Is Painted Again
 	*/
 	virtual void Update(VRect Rect) {
 		if (Parent() != nullptr) {
+			Parent()->ContentDirty = true;
+
 			return Parent()->Update(Rect);
 		}
 	}
 	/*
 	 * Update Functional:
-	 *	@description  : Update Itself
+	 *	@description  : Update Itself ( The Content Changed, Paint It Again )
 	*/
 	void Update() {
+		ContentDirty = true;
+
 		Update(SurfaceRegion());
 	}
 
 	/*
 	 * UpdateObject Functional:
-	 *	@description  : Use The Object's Region To Update
+	 *	@description  : Use The Object's Region To Update ( The Content Changed, Paint It Again )
 	*/
 	void UpdateObject() {
+		ContentDirty = true;
+
 		Update(SurfaceRegion());
 	}
 
@@ -371,14 +743,14 @@ protected:
 	*/
 	bool CheckUIFocusStats(VPoint MouseStats, VMessage* ResourceMessage) {
 		if (IsGlobalIDLocking() == true &&
-			GetGlobalFocusID() != Kernel()->GlobalID) {
+			GetGlobalFocusID() != Kernel()->Handle) {
 			return false;
 		}
 
-		if (MouseStats.InsideRect(Surface()->Rect)) {
+		if (MouseStats.InsideRect(ObjectRect())) {
 			if (ResourceMessage->GetType() == VMessageType::CheckLocalFocusMessage) {
-				if (GetGlobalFocusID() != Kernel()->GlobalID) {
-					Surface()->UIStats = VUIObjectUIStats::Normal;
+				if (GetGlobalFocusID() != Kernel()->Handle) {
+					SetUIStats(VUIObjectUIStats::Normal);
 
 					UpdateObject();
 					LosedMouseFocus();
@@ -389,17 +761,15 @@ protected:
 				return false;
 			}
 
-			if (Surface()->UIStats != VUIObjectUIStats::OnFocus) {
-				VCheckFocusMessage* FocusMessage = new VCheckFocusMessage(MouseStats);
-
-				SendMessageToGlobalWidget(FocusMessage);
+			if (GetUIStats() != VUIObjectUIStats::OnFocus) {
+				VCheckFocusMessage FocusMessage(MouseStats);
 
-				delete FocusMessage;
+				SendMessageToGlobalWidget(&FocusMessage);
 
-				Surface()->UIStats = VUIObjectUIStats::OnFocus;
+				SetUIStats(VUIObjectUIStats::OnFocus);
 				UpdateObject();
 
-				SetGlobalFocusID(Kernel()->GlobalID);
+				SetGlobalFocusID(Kernel()->Handle);
 
 				GotMouseFocus();
 			}
@@ -425,11 +795,11 @@ protected:
 
 			return true;
 		}
-		else if (Surface()->UIStats == VUIObjectUIStats::OnFocus) {
-			Surface()->UIStats = VUIObjectUIStats::Normal;
+		else if (GetUIStats() == VUIObjectUIStats::OnFocus) {
+			SetUIStats(VUIObjectUIStats::Normal);
 			UpdateObject();
 
-			SetGlobalFocusID(L"");
+			SetGlobalFocusID(VObjectHandle());
 
 			LosedMouseFocus();
 
@@ -467,11 +837,15 @@ protected:
 
 		auto Result = CheckUIFocusStats(MousePosition, ResourceMessage);
 
-		if (MousePosition.InsideRect(Surface()->Rect) == true) {
+		if (MousePosition.InsideRect(ObjectRect()) == true) {
 			SendMessageToChild(ResourceMessage);
 
 			return true;
 		}
+		/* the Lock Holder Under This Object Still Follows the Mouse After It Leaves Our Rect */
+		if (GetFocusLockedChild() != nullptr) {
+			SendMessageToChild(ResourceMessage);
+		}
 
 		return Result;
 	}
@@ -492,7 +866,7 @@ public:
 			return SendMessageToChild(Message, false);
 		}
 
-		if (Surface()->UIStats == VUIObjectUIStats::Hidden) {
+		if (GetUIStats() == VUIObjectUIStats::Hidden) {
 			return false;
 		}
 
@@ -502,9 +876,9 @@ public:
 		case VMessageType::GetRepaintAeraMessage: {
 			/* If Two Region Already Own Across Aera, Fusion It */
 			VGetRepaintAeraMessage* RepaintMessage = static_cast<VGetRepaintAeraMessage*>(Message);
-			if (*(RepaintMessage->RepaintAera) != Surface()->Rect &&
-				RepaintMessage->RepaintAera->Overlap(Surface()->Rect) == true) {
-				(*(RepaintMessage->RepaintAera)).FusionRect(Surface()->Rect);
+			if (RepaintMessage->RepaintAera != ObjectRect() &&
+				RepaintMessage->RepaintAera.Overlap(ObjectRect()) == true) {
+				RepaintMessage->RepaintAera.FusionRect(ObjectRect());
 
 				return true;
 			}
@@ -525,29 +899,59 @@ public:
 		case VMessageType::RepaintMessage: {
 			auto RepaintMesage = static_cast<VRepaintMessage*>(Message);
 
-			if (RepaintMesage->DirtyRectangle.Overlap(Surface()->Rect) &&
+			if (RepaintMesage->DirtyRectangle.Overlap(ObjectRect()) &&
 				(Parent()->IsApplication() == true ? true : 
 					Parent()->GetRegoin().
 						OffsetRV(Parent()->GetX(), Parent()->GetY())
 						->Overlap(Parent()->SurfaceRect()))
 				) {
-				if (ObjectCanvas != nullptr) {
+				VDisplayList* ParentDisplayList = Parent()->GetDisplayList();
+
+				/* The Cached Layer Is Reused Unless the Content Or the Size Changed, Backdrop Readers Always Paint */
+				if (ObjectCanvas == nullptr || ContentDirty == true || ReadsBackdrop() == true ||
+					ObjectCanvas->GetWidth() != SurfaceRegion().GetWidth() ||
+					ObjectCanvas->GetHeight() != SurfaceRegion().GetHeight()) {
 					delete ObjectCanvas;
 
-					ObjectCanvas = nullptr;
-				}
+					ObjectCanvas = new VCanvas(SurfaceRegion().GetWidth(),
+						SurfaceRegion().GetHeight());
+
+					CanvasTransparency = 255;
+
+					if (ParentDisplayList != nullptr && ReadsBackdrop() == true) {
+						ParentDisplayList->Flush();
+					}
+
+					{
+						char PaintDetail[48] = { 0 };
+
+						if (VProfiler::Instance().IsEnable() == true) {
+							GetProfileDetail(PaintDetail, sizeof(PaintDetail));
+						}
+
+						VProfileScopeEx("OnPaint", "Paint", PaintDetail);
 
-				ObjectCanvas = new VCanvas(SurfaceRegion().GetWidth(),
-					SurfaceRegion().GetHeight());
-				OnPaint(ObjectCanvas);
+						OnPaint(ObjectCanvas);
+					}
+
+					EditCanvas(ObjectCanvas);
 
-				if (Surface()->Transparency != 255) {
-					ObjectCanvas->SetTransparency(Surface()->Transparency);
+					ContentDirty = false;
 				}
 
-				EditCanvas(ObjectCanvas);
+				/* The Transparency Is Applied When Compositing, the Layer Pixels Never Change For It */
+				if (GetTransparency() != CanvasTransparency) {
+					ObjectCanvas->SetTransparency(GetTransparency());
 
-				GetParentCanvas()->PaintCanvas(Surface()->Rect.left, Surface()->Rect.top, ObjectCanvas);
+					CanvasTransparency = GetTransparency();
+				}
+
+				if (ParentDisplayList != nullptr) {
+					ParentDisplayList->Record(ObjectCanvas, ObjectRect().left, ObjectRect().top, GetTransparency());
+				}
+				else {
+					GetParentCanvas()->PaintCanvas(ObjectRect().left, ObjectRect().top, ObjectCanvas);
+				}
 
 				return true;
 			}
@@ -571,6 +975,8 @@ public:
 				ObjectCanvas = nullptr;
 			}
 
+			ContentDirty = true;
+
 			return true;
 		}
 		case VMessageType::CheckLocalFocusMessage: {
@@ -589,27 +995,47 @@ public:
 
 	/*
 	 * SetTransparency Functional:
-	 *	@description  : Set the Object's Transparency
+	 *	@description  : Set the Object's Transparency ( Composite Only, the Layer Is Not Painted Again )
 	*/
 	void SetTransparency(short Transparency) {
-		ObjectSurface->Transparency = Transparency;
+		_VL_Object_Store.SetTransparency(ObjectIndex(), Transparency);
 
-		Update();
+		Update(SurfaceRegion());
 	}
 	/*
 	 * SetTransparency Functional:
 	 *	@description  : Get the Object's Transparency
 	*/
 	short GetTransparency() {
-		return ObjectSurface->Transparency;
+		return _VL_Object_Store.Transparency(ObjectIndex());
 	}
 
-protected:
-	/* Object Kernel (Attribute) */
-	VUIObjectKernel* ObjectKernel;
+	/*
+	 * SetOpaque Functional:
+	 *	@description  : Mark the Object Cover Every Pixel Of Its Rect, So Objects Under It Could Be Culled
+	*/
+	void SetOpaque(bool Opaque) {
+		_VL_Object_Store.SetOpaque(ObjectIndex(), Opaque);
+	}
+	/*
+	 * IsOpaque virtual Functional:
+	 *	@description  : Is the Object Fully Cover Its Rect In This Frame
+	*/
+	virtual bool IsOpaque() {
+		return _VL_Object_Store.IsOpaque(ObjectIndex()) ||
+			(IsContentOpaque() == true && _VL_Object_Store.IsFullyShown(ObjectIndex()) == true);
+	}
+	/*
+	 * IsContentOpaque virtual Functional:
+	 *	@description  : Does the Object's Own Painting Cover Every Pixel Of Its Rect ( Controls Answer From Their Theme )
+	*/
+	virtual bool IsContentOpaque() {
+		return false;
+	}
 
-	/* UI Surface Stats */
-	VUIObjectSurface* ObjectSurface;
+protected:
+	/* Object Kernel (Attribute), the Surface Stats Live In _VL_Object_Store */
+	VUIObjectKernel ObjectKernel;
 
 public:
 	/*
@@ -617,7 +1043,7 @@ public:
 	 *	@description  : Set the Global Focus
 	*/
 	void GetGlobalFocus() {
-		SetGlobalFocusID(ObjectKernel->GlobalID);
+		SetGlobalFocusID(ObjectKernel.Handle);
 	}
 
 public:
@@ -626,14 +1052,50 @@ public:
 	*/
 
 	VUIObject(VUIObject* Parent) {
-		/* Init Kernel */
-		ObjectKernel = new VUIObjectKernel;
+		ObjectKernel.Handle = _VL_Object_Handle_Table.Allocate(this);
+
 		/* Init Surface */
-		ObjectSurface = new VUIObjectSurface;
+		_VL_Object_Store.Attach(ObjectIndex());
 
 		/* Set Object's Parent Object */
 		SetParent(Parent);
 	}
+	virtual ~VUIObject() {
+		SetParent(nullptr);
+
+		for (VUIObject* ChildObject = ObjectKernel.FirstChild; ChildObject != nullptr;) {
+			VUIObject* NextObject = ChildObject->ObjectKernel.NextSibling;
+
+			ChildObject->ObjectKernel.Parent      = nullptr;
+			ChildObject->ObjectKernel.PrevSibling = nullptr;
+			ChildObject->ObjectKernel.NextSibling = nullptr;
+
+			_VL_Object_Store.SetParentIndex(ChildObject->ObjectIndex(), VUIObjectStore::NoParent);
+
+			ChildObject = NextObject;
+		}
+
+		_VL_Object_Store.Detach(ObjectIndex());
+		_VL_Object_Handle_Table.Release(ObjectKernel.Handle);
+
+		delete ObjectCanvas;
+	}
+
+	/*
+	 * GetHandle Functional:
+	 *	@description  : Get the Object's Handle
+	*/
+	VObjectHandle GetHandle() {
+		return ObjectKernel.Handle;
+	}
+	/*
+	 * FromHandle Functional:
+	 *	@description  : Resolve a Handle
+	 *	@return value : The Object, nullptr If It Was Deleted
+	*/
+	static VUIObject* FromHandle(VObjectHandle Handle) {
+		return _VL_Object_Handle_Table.Get(Handle);
+	}
 
 public:
 	/*
@@ -653,37 +1115,142 @@ public:
 		return false;
 	}
 
+private:
+	/*
+	 * UnlinkSibling Functional:
+	 *	@description  : Take the Object Out Of Parent's Child List
+	*/
+	void UnlinkSibling() {
+		VUIObjectKernel* ParentKernel = Parent()->Kernel();
+
+		if (ObjectKernel.PrevSibling != nullptr) {
+			ObjectKernel.PrevSibling->ObjectKernel.NextSibling = ObjectKernel.NextSibling;
+		}
+		else {
+			ParentKernel->FirstChild = ObjectKernel.NextSibling;
+		}
+		if (ObjectKernel.NextSibling != nullptr) {
+			ObjectKernel.NextSibling->ObjectKernel.PrevSibling = ObjectKernel.PrevSibling;
+		}
+		else {
+			ParentKernel->LastChild = ObjectKernel.PrevSibling;
+		}
+
+		ObjectKernel.PrevSibling = nullptr;
+		ObjectKernel.NextSibling = nullptr;
+
+		--ParentKernel->ChildCount;
+	}
+	/*
+	 * LinkSibling Functional:
+	 *	@description  : Put the Object On the Top ( Or Bottom ) Of Parent's Child List
+	*/
+	void LinkSibling(bool OnTop) {
+		VUIObjectKernel* ParentKernel = Parent()->Kernel();
+
+		if (OnTop == true) {
+			ObjectKernel.PrevSibling = ParentKernel->LastChild;
+
+			if (ParentKernel->LastChild != nullptr) {
+				ParentKernel->LastChild->ObjectKernel.NextSibling = this;
+			}
+			else {
+				ParentKernel->FirstChild = this;
+			}
+
+			ParentKernel->LastChild = this;
+			ObjectKernel.ZOrder     = ++ParentKernel->TopZOrder;
+		}
+		else {
+			ObjectKernel.NextSibling = ParentKernel->FirstChild;
+
+			if (ParentKernel->FirstChild != nullptr) {
+				ParentKernel->FirstChild->ObjectKernel.PrevSibling = this;
+			}
+			else {
+				ParentKernel->LastChild = this;
+			}
+
+			ParentKernel->FirstChild = this;
+			ObjectKernel.ZOrder      = --ParentKernel->BottomZOrder;
+		}
+
+		++ParentKernel->ChildCount;
+	}
+
 public:
 	/*
 	 * SetParent Functional:
-	 *	@description  : This Functional Set Object Parent Into Other Object
+	 *	@description  : This Functional Set Object Parent Into Other Object ( On the Top )
 	*/
 	void SetParent(VUIObject* NewParent) {
-		if (ObjectKernel->Parent != nullptr) {
-			/* Adjust Child Id For Container's Objects */
-			for (auto Object = Parent()->Kernel()->ChildObjectContainer.begin() + (Kernel()->ParentID + 1);
-				Object != Parent()->Kernel()->ChildObjectContainer.end(); ++Object) {
-				--Object.operator*()->Kernel()->ParentID;
-			}
-
+		if (ObjectKernel.Parent != nullptr) {
 			/* Erase This Object From Parent */
-			Parent()->Kernel()->ChildObjectContainer.
-				erase(Parent()->Kernel()->ChildObjectContainer.begin()
-					+ Kernel()->ParentID);
+			UnlinkSibling();
+
+			Parent()->Kernel()->ChildHitIndex.Remove(this);
+
+			auto& ParentFocusedChild = Parent()->Kernel()->MouseFocusedChild;
+			ParentFocusedChild.erase(std::remove(ParentFocusedChild.begin(), ParentFocusedChild.end(), this), ParentFocusedChild.end());
 		}
 
-		ObjectKernel->Parent = NewParent;
+		ObjectKernel.Parent = NewParent;
+
+		_VL_Object_Store.SetParentIndex(ObjectIndex(), NewParent != nullptr ? NewParent->ObjectIndex() : VUIObjectStore::NoParent);
 
 		/* If NewParent Isn't nullptr, Init Project Attrubite  */
 		if (VUnlikely(NewParent != nullptr)) {
-			Parent()->Kernel()->ChildObjectContainer.push_back(this);
+			LinkSibling(true);
+
+			UpdateHitIndex();
+		}
+	}
+
+	/*
+	 * Raise Functional:
+	 *	@description  : Move the Object Above Its Siblings
+	*/
+	void Raise() {
+		if (Parent() != nullptr && ObjectKernel.NextSibling != nullptr) {
+			UnlinkSibling();
+			LinkSibling(true);
+
+			Update();
+		}
+	}
+	/*
+	 * Lower Functional:
+	 *	@description  : Move the Object Below Its Siblings
+	*/
+	void Lower() {
+		if (Parent() != nullptr && ObjectKernel.PrevSibling != nullptr) {
+			UnlinkSibling();
+			LinkSibling(false);
 
-			/* Generated Object ID */
-			Kernel()->ParentID = Parent()->Kernel()->ChildObjectContainer.size() - 1;
-			Kernel()->GlobalID = GeneratedGlobalID();
+			Update();
 		}
 	}
 
+	/*
+	 * Child Iteration Functional:
+	 *	@description  : Walk the Children In Paint Order ( Bottom First )
+	*/
+	VUIObject* GetFirstChild() {
+		return ObjectKernel.FirstChild;
+	}
+	VUIObject* GetLastChild() {
+		return ObjectKernel.LastChild;
+	}
+	VUIObject* GetNextSibling() {
+		return ObjectKernel.NextSibling;
+	}
+	VUIObject* GetPrevSibling() {
+		return ObjectKernel.PrevSibling;
+	}
+	size_t     GetChildCount() {
+		return ObjectKernel.ChildCount;
+	}
+
 public:
 	/*
 	 * DealyMessage virtual functional:
@@ -708,25 +1275,28 @@ public:
 	*/
 
 	int  GetX()      const {
-		return ObjectSurface->Rect.left;
+		return ObjectRect().left;
 	}
 	int  GetY()      const {
-		return ObjectSurface->Rect.top;
+		return ObjectRect().top;
 	}
 	int  GetWidth()  const {
-		return ObjectSurface->Rect.right - ObjectSurface->Rect.left;
+		return ObjectRect().right - ObjectRect().left;
 	}
 	int  GetHeight() const {
-		return ObjectSurface->Rect.bottom - ObjectSurface->Rect.top;
+		return ObjectRect().bottom - ObjectRect().top;
 	}
 
 	virtual void Resize(int Width, int Height) {
-		auto OldRect = Surface()->Rect.Clone();
+		auto OldRect = ObjectRect();
+
+		SetObjectRect({ OldRect.left, OldRect.top, OldRect.left + Width, OldRect.top + Height });
+
+		OldRect.FusionRect(ObjectRect());
 
-		Surface()->Rect.right = OldRect.left + Width;
-		Surface()->Rect.bottom = OldRect.top + Height;
+		UpdateHitIndex();
 
-		OldRect.FusionRect(Surface()->Rect);
+		ContentDirty = true;
 
 		Update(OldRect);
 	}
@@ -734,17 +1304,17 @@ public:
 		Resize(Size.x, Size.y);
 	}
 	virtual void Move(int X, int Y) {
-		auto OldRect = Surface()->Rect.Clone();
+		auto OldRect = ObjectRect();
 
 		auto Width = GetWidth();
 		auto Height = GetHeight();
 
-		Surface()->Rect.left = X;
-		Surface()->Rect.top = Y;
-		Surface()->Rect.right = X + Width;
-		Surface()->Rect.bottom = Y + Height;
+		SetObjectRect({ X, Y, X + Width, Y + Height });
 
-		Update();
+		UpdateHitIndex();
+
+		/* Moving Keeps the Layer, Only Both Places Are Composited Again */
+		Update(SurfaceRegion());
 		Update(OldRect);
 	}
 	void Move(VPoint Point) {
@@ -754,10 +1324,26 @@ public:
 public:
 	/*
 	 * CheckFrame virtual Functional:
-	 *	@description  : Each Frame Check the Stats
+	 *	@description  : Each Frame Check the Stats ( Only For Application's Children: Windows And Timers )
 	*/
 	virtual void CheckFrame() {  /* Empty */ }
 
+	/*
+	 * TickAnimation virtual Functional:
+	 *	@description  : Step the Object's Animation, Only Called After StartAnimationTick
+	 *	@return value : Keep Animating Or Not ( Leave the Animation Registry )
+	*/
+	virtual bool TickAnimation() {
+		return false;
+	}
+	/*
+	 * StartAnimationTick Functional:
+	 *	@description  : Join the Animation Registry, TickAnimation Will Be Called Each Frame Until It Returns false
+	*/
+	void StartAnimationTick() {
+		_VL_Animation_Registry.Join(ObjectKernel.Handle);
+	}
+
 	/*
 	 * CheckAllFrame Functional:
 	 *	@description  : Check All the Objects Frame
@@ -765,16 +1351,16 @@ public:
 	void CheckAllFrame(bool CheckChild = false) {
 		CheckFrame();
 
-		if (CheckChild == false) {
-			for (auto& ChildObject : Kernel()->ChildObjectContainer) {
-				ChildObject->CheckFrame();
-			}
-		}
-		else {
-			for (auto& ChildObject : Kernel()->ChildObjectContainer) {
-				ChildObject->CheckFrame();
+		for (VUIObject* ChildObject = Kernel()->FirstChild; ChildObject != nullptr;) {
+			VUIObject* NextObject = ChildObject->Kernel()->NextSibling;
+
+			ChildObject->CheckFrame();
+
+			if (CheckChild == true) {
 				ChildObject->CheckAllFrame(CheckChild);
 			}
+
+			ChildObject = NextObject;
 		}
 	}
 };
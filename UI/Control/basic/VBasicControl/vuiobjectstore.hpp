@@ -0,0 +1,157 @@
+﻿/*
+ * VUIObjectStore.hpp
+ *	@description : The Contiguous Geometry And Stats Of Every UI Object
+ *	@birth		 : 2022/7.18
+*/
+
+#pragma once
+
+#include "../../../basic/vbasic/vbase.hpp"
+
+#include <vector>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VUIObjectUIStats
+*/
+enum VUIObjectUIStats {
+	Hidden, OnClicked, OnFocus, Normal
+};
+
+/*
+ * VUIObjectStore class:
+ *	@description  : The Per-object Geometry And Stats, One Array Per Field Indexed By Object Handle
+ *					Index. Slots Follow Handle Allocation, Not the Tree, So Passes Over Siblings
+ *					Gather Their Slots By Index ( See QueryOverlap ). Accessors Return Values:
+ *					the Arrays Move Whenever a New Object Grows Them
+*/
+class VUIObjectStore {
+public:
+	/* The Parent Index Of Root Objects */
+	static const unsigned int NoParent = 0xFFFFFFFFu;
+
+private:
+	std::vector<VRect>            Rects;
+	std::vector<short>            Transparencies;
+	std::vector<VUIObjectUIStats> UIStats;
+	std::vector<unsigned char>    Opaques;
+	std::vector<unsigned int>     ParentIndices;
+
+public:
+	/*
+	 * Attach Functional:
+	 *	@description  : Reset the Slot For a New Object ( Grow the Arrays If Needed )
+	*/
+	void Attach(unsigned int Index) {
+		if (Index >= Rects.size()) {
+			size_t NewSize = Index + 1;
+
+			Rects.resize(NewSize);
+			Transparencies.resize(NewSize);
+			UIStats.resize(NewSize);
+			Opaques.resize(NewSize);
+			ParentIndices.resize(NewSize);
+		}
+
+		Rects[Index]          = VRect();
+		Transparencies[Index] = 255;
+		UIStats[Index]        = VUIObjectUIStats::Normal;
+		Opaques[Index]        = 0;
+		ParentIndices[Index]  = NoParent;
+	}
+	/*
+	 * Detach Functional:
+	 *	@description  : Mark the Slot Unused ( Hidden, No Parent )
+	*/
+	void Detach(unsigned int Index) {
+		UIStats[Index]       = VUIObjectUIStats::Hidden;
+		ParentIndices[Index] = NoParent;
+	}
+
+public:
+	/*
+	 * Slot Accessor Functional
+	*/
+
+	VRect             Rect(unsigned int Index) const {
+		return Rects[Index];
+	}
+	short             Transparency(unsigned int Index) const {
+		return Transparencies[Index];
+	}
+	VUIObjectUIStats  Stats(unsigned int Index) const {
+		return UIStats[Index];
+	}
+	unsigned int      ParentIndex(unsigned int Index) const {
+		return ParentIndices[Index];
+	}
+
+	void              SetRect(unsigned int Index, VRect Rect) {
+		Rects[Index] = Rect;
+	}
+	void              SetTransparency(unsigned int Index, short Transparency) {
+		Transparencies[Index] = Transparency;
+	}
+	void              SetStats(unsigned int Index, VUIObjectUIStats Stats) {
+		UIStats[Index] = Stats;
+	}
+	void              SetParentIndex(unsigned int Index, unsigned int ParentIndex) {
+		ParentIndices[Index] = ParentIndex;
+	}
+	void              SetOpaque(unsigned int Index, bool Opaque) {
+		Opaques[Index] = Opaque == true ? 1 : 0;
+	}
+
+	/*
+	 * IsOpaque Functional:
+	 *	@description  : Does the Object Fully Cover Its Rect
+	*/
+	bool IsOpaque(unsigned int Index) const {
+		return Opaques[Index] != 0 && IsFullyShown(Index);
+	}
+	/*
+	 * IsFullyShown Functional:
+	 *	@description  : Is the Object Shown Without Any Transparency
+	*/
+	bool IsFullyShown(unsigned int Index) const {
+		return Transparencies[Index] == 255 && UIStats[Index] != VUIObjectUIStats::Hidden;
+	}
+	/*
+	 * IsHidden Functional:
+	 *	@description  : Is the Object Hidden
+	*/
+	bool IsHidden(unsigned int Index) const {
+		return UIStats[Index] == VUIObjectUIStats::Hidden;
+	}
+
+public:
+	/*
+	 * QueryOverlap Functional:
+	 *	@description  : Mark Which Of the Objects Are Visible And Overlap the Rect ( Branch-free Per Gathered Slot )
+	 *	@return value : How Many Objects Are Marked
+	*/
+	size_t QueryOverlap(const unsigned int* Indices, size_t Count, VRect Aera, std::vector<unsigned char>& Result) const {
+		Result.resize(Count);
+
+		size_t MarkedCount = 0;
+
+		for (size_t Position = 0; Position < Count; ++Position) {
+			const unsigned int Index  = Indices[Position];
+			const VRect&       Object = Rects[Index];
+
+			unsigned char Marked = static_cast<unsigned char>(
+				(Object.left < Aera.right) & (Aera.left < Object.right) &
+				(Object.top < Aera.bottom) & (Aera.top < Object.bottom) &
+				(Object.left < Object.right) & (Object.top < Object.bottom) &
+				(UIStats[Index] != VUIObjectUIStats::Hidden));
+
+			Result[Position] = Marked;
+			MarkedCount     += Marked;
+		}
+
+		return MarkedCount;
+	}
+};
+
+VLIB_END_NAMESPACE
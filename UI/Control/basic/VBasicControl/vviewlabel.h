@@ -21,7 +21,7 @@ enum class VScrollButtonRadiusMode {
 */
 class VScrollButton : public VAbstractButton {
 private:
-	VScrollButtonTheme* Theme;
+	VThemeHandle<VScrollButtonTheme> Theme;
 
 	VColorInterpolator BackgroundColor;
 	VColorInterpolator LineColor;
@@ -47,14 +47,18 @@ public:
 	*/
 
 	VScrollButton(VUIObject* Parent, std::wstring PlaneString = L"") : VAbstractButton(Parent),
-		BackgroundColor(0.1, VInterpolatorType::AccelerateInterpolator),
-		LineColor(0.1, VInterpolatorType::AccelerateInterpolator) {
-		Theme = new VScrollButtonTheme(*(static_cast<VScrollButtonTheme*>(SearchThemeFromParent(VSCROLLBUTTON_THEME))));
-		Theme->PlaneString = PlaneString;
+		BackgroundColor(160, VInterpolatorType::AccelerateInterpolator),
+		LineColor(160, VInterpolatorType::AccelerateInterpolator) {
+		Theme = GetThemeHandle<VScrollButtonTheme>(VSCROLLBUTTON_THEME);
 
 		if (VUnlikely(Theme == nullptr)) {
 			VAssertBox(L"Error! Can't Get the Native Theme Of VScrollButton");
 		}
+
+		/* Keep Sharing the Native Theme Until Something Differs */
+		if (PlaneString.empty() == false) {
+			Theme.Edit()->PlaneString = PlaneString;
+		}
 	}
 
 	/*
@@ -79,11 +83,13 @@ public:
 			BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->OnClickedBackgroundColor);
 			LineColor.Start(Theme->CurrentLineColor, Theme->OnClickedLineColor);
 
+			StartAnimationTick();
+
 			InDrag = true;
 
 			ButtonDragedStart.Emit();
 
-			LockGlobalFocusID(Kernel()->GlobalID);
+			LockGlobalFocusID(Kernel()->Handle);
 		}
 	}
 	void LeftClickedUp() override {
@@ -93,6 +99,8 @@ public:
 		BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->BackgroundColor);
 		LineColor.Start(Theme->CurrentLineColor, Theme->LineColor);
 
+		StartAnimationTick();
+
 		ButtonDragedEnd.Emit();
 
 		UnlockGlobalFocusID();
@@ -102,6 +110,8 @@ public:
 			BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->OnHoverBackgroundColor);
 			LineColor.Start(Theme->CurrentLineColor, Theme->OnHoverLineColor);
 
+			StartAnimationTick();
+
 			ButtonOnHover.Emit();
 
 			InMouseFocus = true;
@@ -132,6 +142,8 @@ public:
 				BackgroundColor.Start(Theme->CurrentBackgroundColor, Theme->BackgroundColor);
 				LineColor.Start(Theme->CurrentLineColor, Theme->LineColor);
 
+				StartAnimationTick();
+
 				ButtonDragedEnd.Emit();
 
 				UnlockGlobalFocusID();
@@ -156,18 +168,20 @@ public:
 	}
 
 public:
-	void CheckFrame() override {
+	bool TickAnimation() override {
 		if (BackgroundColor.IsAnimationEnd() == false ||
 			LineColor.IsAnimationEnd() == false) {
-			Theme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
-			Theme->CurrentLineColor = LineColor.GetOneFrame();
+			VScrollButtonTheme* AnimatedTheme = Theme.Edit();
+
+			AnimatedTheme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
+			AnimatedTheme->CurrentLineColor = LineColor.GetOneFrame();
 
 			Update();
-		}
 
-		if (InDrag == true) {
-			SetGlobalFocusID(Kernel()->GlobalID);
+			return true;
 		}
+
+		return false;
 	}
 };
 
@@ -179,7 +193,7 @@ class VScrollBarHeight : public VUIObject {
 private:
 	VScrollButton*   ViewButton;
 
-	VScrollBarTheme* Theme;
+	VThemeHandle<VScrollBarTheme> Theme;
 
 	int              ViewHeight;
 
@@ -208,11 +222,15 @@ private:
 	void BarButtonDragStarted() {
 		BackgroundColor.Start(Theme->BackgroundColor, Theme->OnDragBackgroundColor);
 		LineColor.Start(Theme->LineColor, Theme->OnDragLineColor);
+
+		StartAnimationTick();
 	}
 	void BarButtonDragStopped() {
 		EndDragAnimaiton();
 		BackgroundColor.Start(Theme->OnDragBackgroundColor, Theme->BackgroundColor);
 		LineColor.Start(Theme->OnDragLineColor, Theme->LineColor);
+
+		StartAnimationTick();
 	}
 	void BarButtonClickDraged(int MouseX, int MouseY) {
 		if (MouseY >= GetY() &&
@@ -260,6 +278,8 @@ private:
 			BackgroundColor.Start(Theme->BackgroundColor, Theme->OnDragBackgroundColor);
 			LineColor.Start(Theme->LineColor, Theme->OnDragLineColor);
 
+			StartAnimationTick();
+
 			if (MouseY + ViewButton->GetHeight() >= GetY() + GetHeight()) {
 				ViewButton->Move(GetX() + (11.f / 2 - double(ViewButton->GetWidth()) / 2), GetY() + GetHeight() - ViewButton->GetHeight());
 			}
@@ -270,6 +290,8 @@ private:
 		else {
 			BackgroundColor.Start(Theme->OnDragBackgroundColor, Theme->BackgroundColor);
 			LineColor.Start(Theme->OnDragLineColor, Theme->LineColor);
+
+			StartAnimationTick();
 		}
 	}
 
@@ -283,8 +305,8 @@ public:
 
 	VScrollBarHeight(VUIObject* Parent, int RealH, int ViewH) : 
 		VUIObject(Parent),
-		BackgroundColor(0.1, VInterpolatorType::AccelerateInterpolator),
-		LineColor(0.1, VInterpolatorType::AccelerateInterpolator) {
+		BackgroundColor(160, VInterpolatorType::AccelerateInterpolator),
+		LineColor(160, VInterpolatorType::AccelerateInterpolator) {
 
 		ViewButton = new VScrollButton(Parent);
 
@@ -303,7 +325,7 @@ public:
 		ViewButton->Resize(4, RealH * RealH / double(ViewH));
 		ViewButton->Move(GetX() + (11.f / 2 - double(ViewButton->GetWidth()) / 2), GetY());
 
-		Theme = new VScrollBarTheme(*(static_cast<VScrollBarTheme*>(SearchThemeFromParent(VSCROLLBAR_THEME))));
+		Theme = GetThemeHandle<VScrollBarTheme>(VSCROLLBAR_THEME);
 
 		ViewHeight = ViewH;
 	}
@@ -344,21 +366,27 @@ public:
 	}
 
 public:
-	void CheckFrame() override {
+	bool TickAnimation() override {
 		if (BackgroundColor.IsAnimationEnd() == false ||
 			LineColor.IsAnimationEnd() == false) {
-			Theme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
-			Theme->CurrentLineColor       = LineColor.GetOneFrame();
+			VScrollBarTheme* AnimatedTheme = Theme.Edit();
+
+			AnimatedTheme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
+			AnimatedTheme->CurrentLineColor       = LineColor.GetOneFrame();
 
 			Update();
+
+			return true;
 		}
+
+		return false;
 	}
 };
 class VScrollBarWidth : public VUIObject {
 private:
 	VScrollButton* ViewButton;
 
-	VScrollBarTheme* Theme;
+	VThemeHandle<VScrollBarTheme> Theme;
 
 	int              ViewWidth;
 
@@ -387,11 +415,15 @@ private:
 	void BarButtonDragStarted() {
 		BackgroundColor.Start(Theme->BackgroundColor, Theme->OnDragBackgroundColor);
 		LineColor.Start(Theme->LineColor, Theme->OnDragLineColor);
+
+		StartAnimationTick();
 	}
 	void BarButtonDragStopped() {
 		EndDragAnimaiton();
 		BackgroundColor.Start(Theme->OnDragBackgroundColor, Theme->BackgroundColor);
 		LineColor.Start(Theme->OnDragLineColor, Theme->LineColor);
+
+		StartAnimationTick();
 	}
 	void BarButtonClickDraged(int MouseX, int MouseY) {
 		if (MouseX >= GetX() &&
@@ -436,6 +468,8 @@ private:
 			BackgroundColor.Start(Theme->BackgroundColor, Theme->OnDragBackgroundColor);
 			LineColor.Start(Theme->LineColor, Theme->OnDragLineColor);
 
+			StartAnimationTick();
+
 			if (MouseX + ViewButton->GetWidth() >= GetX() + GetWidth()) {
 				ViewButton->Move(GetX() + GetWidth() - ViewButton->GetWidth(), ViewButton->GetY());
 			}
@@ -448,6 +482,8 @@ private:
 		else {
 			BackgroundColor.Start(Theme->OnDragBackgroundColor, Theme->BackgroundColor);
 			LineColor.Start(Theme->OnDragLineColor, Theme->LineColor);
+
+			StartAnimationTick();
 		}
 	}
 
@@ -472,8 +508,8 @@ public:
 
 	VScrollBarWidth(VUIObject* Parent, int RealW, int ViewW) :
 		VUIObject(Parent),
-		BackgroundColor(0.1, VInterpolatorType::AccelerateInterpolator),
-		LineColor(0.1, VInterpolatorType::AccelerateInterpolator) {
+		BackgroundColor(160, VInterpolatorType::AccelerateInterpolator),
+		LineColor(160, VInterpolatorType::AccelerateInterpolator) {
 
 		ViewButton = new VScrollButton(Parent);
 
@@ -493,7 +529,7 @@ public:
 		ViewButton->Resize(RealW * RealW / double(ViewW), 4);
 		ViewButton->Move(GetX(), GetY() + 3);
 
-		Theme = new VScrollBarTheme(*(static_cast<VScrollBarTheme*>(SearchThemeFromParent(VSCROLLBAR_THEME))));
+		Theme = GetThemeHandle<VScrollBarTheme>(VSCROLLBAR_THEME);
 
 		ViewWidth = ViewW;
 	}
@@ -523,14 +559,20 @@ public:
 	}
 
 public:
-	void CheckFrame() override {
+	bool TickAnimation() override {
 		if (BackgroundColor.IsAnimationEnd() == false ||
 			LineColor.IsAnimationEnd() == false) {
-			Theme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
-			Theme->CurrentLineColor = LineColor.GetOneFrame();
+			VScrollBarTheme* AnimatedTheme = Theme.Edit();
+
+			AnimatedTheme->CurrentBackgroundColor = BackgroundColor.GetOneFrame();
+			AnimatedTheme->CurrentLineColor = LineColor.GetOneFrame();
 
 			Update();
+
+			return true;
 		}
+
+		return false;
 	}
 };
 
@@ -8,6 +8,7 @@
 #include "vapplication.hpp"
 
 #include "../../../basic/vbasic/vtimer.hpp"
+#include "../../../render/vrender/vpresentdevice.hpp"
 
 #include <map>
 
@@ -22,6 +23,17 @@ std::map<HWND, VPoint>              VMainWindowMaxInfoMessage;
  *	@desecription  : The VMainWindow Window Event Dealy Function
 */
 LRESULT VMainWindowProcess(HWND Handle, UINT Message, WPARAM wParameter, LPARAM lParameter) {
+	/* Input Wakes the Application Loop After It Is Queued */
+	if ((Message >= WM_MOUSEFIRST && Message <= WM_MOUSELAST) || (Message >= WM_KEYFIRST && Message <= WM_KEYLAST)) {
+		LRESULT Result = VOriginWindowProcessFunctional(Handle, Message, wParameter, lParameter);
+
+		if (VCoreApplication::Instance() != nullptr) {
+			VCoreApplication::Instance()->Wake();
+		}
+
+		return Result;
+	}
+
 	switch (Message) {
 	case WM_SIZING: {
 		RECT* Rect = (RECT*)lParameter;
@@ -70,11 +82,13 @@ LRESULT VMainWindowProcess(HWND Handle, UINT Message, WPARAM wParameter, LPARAM
 */
 class VMainWindow : public VUIObject {
 private:
-	VWidgetTheme* Theme;
+	VThemeHandle<VWidgetTheme> Theme;
 
 private:
 	std::vector<VRepaintMessage*> RepaintMessageStack;
+	VDisplayList                  FrameDisplayList;
 
+	VMemoryPtr<VPresentDevice>    PresentDevice;
 	HWND                          WindowHandle;
 
 private:
@@ -106,14 +120,17 @@ public:
 	}
 
 private:
-	VTimer                        FpsTimer;
+	VFrameScheduler*              FrameScheduler = nullptr;
+
+	bool                          FrameGraphVisible = false;
+	VRect                         FrameGraphRect = { 0, 0, VFrameStatistics::HistorySize * 2, 64 };
 
 private:
 	bool                          Win32Resized = false;
 	int                           ResizedWidth = 0;
 	int                           ResizedHeight = 0;
 
-	std::wstring                  GlobalFocusID;
+	VObjectHandle                 GlobalFocusID;
 
 	bool                          LockFocusID = false;
 
@@ -121,7 +138,7 @@ protected:
 	/*
 	 * SetGlobalFocusID override Functional
 	*/
-	void SetGlobalFocusID(std::wstring ID) override {
+	void SetGlobalFocusID(VObjectHandle ID) override {
 		if (LockFocusID == false) {
 			GlobalFocusID = ID;
 		}
@@ -129,13 +146,13 @@ protected:
 	/*
 	 * GetGlobalFocusID override Functional
 	*/
-	std::wstring GetGlobalFocusID() override {
+	VObjectHandle GetGlobalFocusID() override {
 		return GlobalFocusID;
 	}
 	/*
 	 * LockGlobalFocusID override Functional
 	*/
-	void LockGlobalFocusID(std::wstring ID) override {
+	void LockGlobalFocusID(VObjectHandle ID) override {
 		if (LockFocusID == false) {
 			LockFocusID = true;
 
@@ -170,9 +187,20 @@ private:
 
 			ResizedWidth = Width;
 			ResizedHeight = Height;
+
+			VCoreApplication::Instance()->RequestNextFrame();
 		}
 	}
 
+protected:
+	/*
+	 * GetDisplayList override Functional:
+	 *	@description  : Children Record Into the Frame Display List While Repainting
+	*/
+	VDisplayList* GetDisplayList() override {
+		return FrameDisplayList.IsRecording() ? &FrameDisplayList : nullptr;
+	}
+
 protected:
 	/*
 	 * SendMessageToGlobalWdiget override Functional
@@ -184,10 +212,12 @@ protected:
 private:
 	/*
 	 * InitKernel Functional:
-	 *	@description  : Init Widget WKernel
+	 *	@description  : Init Widget WKernel ( Follow the Display's Refresh Rate )
 	*/
 	void InitKernel() {
-		FpsTimer.Start(16);
+		FrameScheduler = VCoreApplication::Instance()->GetFrameScheduler();
+
+		FrameScheduler->SetRefreshRate(PresentDevice->GetRefreshRate());
 	}
 
 	/*
@@ -201,65 +231,89 @@ private:
 		VOriginWindowProcessFunctional = reinterpret_cast<WNDPROC>(GetWindowLongPtr(GetHWnd(), GWLP_WNDPROC));
 		SetWindowLongPtr(GetHWnd(), GWLP_WNDPROC, reinterpret_cast<LONG_PTR>(VMainWindowProcess));
 
-		BeginBatchDraw();
-
 		VMainWindowResizeProcess = std::bind(&VMainWindow::VMainWindowResize, this,
 			std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
 	}
 
 	/*
 	 * InitWindow Functional:
-	 *	@description  : Init the Widget
+	 *	@description  : Init the Widget On a Present Device ( Headless Devices Have No Win32 Window )
 	*/
-	HWND InitWindow(int Width, int Height) {
-		HWND Handle = initgraph(Width, Height, EW_SHOWCONSOLE);
+	void InitWindow(int Width, int Height, VPresentDevice* Device) {
+		Resize(Width, Height);
+
+		Theme = GetThemeHandle<VWidgetTheme>(VWIDGET_THEME);
+
+		if (VUnlikely(VCoreApplication::Instance() == nullptr)) {
+			VAssertBox(L"VApplication Should be Inited Before VWidget or VMainWindow");
+
+			exit(-1);
+		}
 
-		InitWindowStyle();
+		PresentDevice.reset(Device);
+		WindowHandle = PresentDevice->GetWindowHandle();
 
-		return Handle;
+		if (WindowHandle != nullptr) {
+			InitWindowStyle();
+		}
+
+		InitKernel();
+
+		Update(ObjectRect());
 	}
 
 protected:
 	/*
 	 * Update override Functional:
-	 *	@description  : Set Repaint Aera
+	 *	@description  : Set Repaint Aera, Children Are Composited Clipped To the Damage So the Aera
+	 *					Only Grows For Backdrop Readers ( They Sample Their Whole Rect From the Frame )
 	*/
 	void Update(VRect Rect) override {
 		VGetRepaintAeraMessage RepaintMessage(Rect);
 
-		std::map<int, int>     AlreadySendedObject;
+		VCoreApplication::Instance()->RequestNextFrame();
 
-		int                    ObjectCount = 0;
+		std::vector<VUIObject*> BackdropReaders;
 
-		for (auto ChildObject = Kernel()->ChildObjectContainer.begin();
-			ChildObject != Kernel()->ChildObjectContainer.end(); ++ObjectCount) {
-			if (AlreadySendedObject.find(ObjectCount) == AlreadySendedObject.end()) {
-				if (ChildObject.operator*()->SysDealyMessage(&RepaintMessage) == true) {
-					AlreadySendedObject.insert(std::pair<int, bool>(ObjectCount, 1));
+		for (VUIObject* ChildObject = GetFirstChild(); ChildObject != nullptr; ChildObject = ChildObject->GetNextSibling()) {
+			if (ChildObject->ReadsBackdrop() == true) {
+				ChildObject->BackdropDamaged(Rect);
 
-					ChildObject = Kernel()->ChildObjectContainer.begin();
+				BackdropReaders.push_back(ChildObject);
+			}
+		}
 
-					ObjectCount = 0;
-					
-					continue;
+		/* A Fusion Grows the Aera And May Reach Other Readers, Each Reader Fuses At Most Once */
+		bool AeraGrown = true;
+
+		while (AeraGrown == true && BackdropReaders.empty() == false) {
+			AeraGrown = false;
+
+			for (size_t Count = 0; Count < BackdropReaders.size();) {
+				if (BackdropReaders[Count]->SysDealyMessage(&RepaintMessage) == true) {
+					BackdropReaders[Count] = BackdropReaders.back();
+					BackdropReaders.pop_back();
+
+					AeraGrown = true;
+				}
+				else {
+					++Count;
 				}
 			}
-
-			++ChildObject;
 		}
 
 		for (auto& AlreadyExsitsMessage : RepaintMessageStack) {
-			if (AlreadyExsitsMessage->DirtyRectangle == *(RepaintMessage.RepaintAera)) {
+			if (AlreadyExsitsMessage->DirtyRectangle == RepaintMessage.RepaintAera) {
 				return;
 			}
 
-			if (AlreadyExsitsMessage->DirtyRectangle.Overlap(*(RepaintMessage.RepaintAera)) == true) {
-				AlreadyExsitsMessage->DirtyRectangle.FusionRect(*(RepaintMessage.RepaintAera));
+			if (AlreadyExsitsMessage->DirtyRectangle.Overlap(RepaintMessage.RepaintAera) == true) {
+				AlreadyExsitsMessage->DirtyRectangle.FusionRect(RepaintMessage.RepaintAera);
 				return;
 			}
 		}
 
-		VRect RepaintRect = *(RepaintMessage.RepaintAera);
+		VRect RepaintRect = RepaintMessage.RepaintAera;
 
 		RepaintMessageStack.push_back(new VRepaintMessage(RepaintRect));
 	}
@@ -270,9 +324,9 @@ public:
 	 *	@description  : Set the Window Background Color
 	*/
 	void SetBackgroundColor(VColor Color) {
-		Theme->BackgroundColor = Color;
+		Theme.Edit()->BackgroundColor = Color;
 
-		Update(Surface()->Rect);
+		Update(ObjectRect());
 	}
 
 public:
@@ -317,67 +371,151 @@ public:
 	*/
 
 	VMainWindow(int Width, int Height, VApplication* Parent) : VUIObject(Parent) {
-		Resize(Width, Height);
+		InitWindow(Width, Height, new VEasyXPresentDevice(Width, Height));
+	}
+	/*
+	 * The Window Takes the Ownership Of Device
+	*/
+	VMainWindow(int Width, int Height, VApplication* Parent, VPresentDevice* Device) : VUIObject(Parent) {
+		InitWindow(Width, Height, Device);
+	}
 
-		Theme = static_cast<VWidgetTheme*>(SearchThemeFromParent(VWIDGET_THEME));
+	/*
+	 * GetPresentDevice Functional:
+	 *	@description  : Get the Device Which Shows the Frames
+	*/
+	VPresentDevice* GetPresentDevice() {
+		return PresentDevice.get();
+	}
 
-		if (VUnlikely(VCoreApplication::Instance() == nullptr)) {
-			VAssertBox(L"VApplication Should be Inited Before VWidget or VMainWindow");
+	/*
+	 * PostResize Functional:
+	 *	@description  : Resize the Window On Next Frame ( Same As a Win32 Resize, Works Headless Too )
+	*/
+	void PostResize(int Width, int Height) {
+		VMainWindowResize(WindowHandle, Width, Height);
+	}
 
-			exit(-1);
-		}
+	/*
+	 * GetFrameStatistics Functional:
+	 *	@description  : Get the Frame-time Statistics
+	*/
+	const VFrameStatistics& GetFrameStatistics() {
+		return FrameScheduler->GetStatistics();
+	}
 
-		InitKernel();
-		WindowHandle = InitWindow(Width, Height);
+	/*
+	 * SetFrameGraphVisible Functional:
+	 *	@description  : Show Or Hide the Frame-time Graph At the Top-left Corner
+	*/
+	void SetFrameGraphVisible(bool Visible) {
+		FrameGraphVisible = Visible;
 
-		Update(Surface()->Rect);
+		Update(FrameGraphRect);
+	}
+	/*
+	 * IsFrameGraphVisible Functional:
+	 *	@description  : Is the Frame-time Graph Shown
+	*/
+	bool IsFrameGraphVisible() {
+		return FrameGraphVisible;
 	}
-	~VMainWindow() { EndBatchDraw(); }
 
-	void CheckFrame() {
-		if (FpsTimer.End() == true) {
-			FpsTimer.Start(16);
+private:
+	/*
+	 * PaintFrameGraph Functional:
+	 *	@description  : Paint the Recent Frame Times As Bars ( Full Height = Two Frame Intervals ),
+	 *					Bars Over One Interval Are Drawn In Red
+	*/
+	void PaintFrameGraph(VCanvas* Canvas) {
+		const VFrameStatistics& Statistics = FrameScheduler->GetStatistics();
 
-			if (Win32Resized == true) {
-				Win32Resized = false;
+		long long      Budget     = FrameScheduler->GetFrameInterval();
+		int            Height     = FrameGraphRect.GetHeight();
 
-				EasyXWindowResize(ResizedWidth, ResizedHeight);
-				Resize(ResizedWidth, ResizedHeight);
+		VPainterDevice Device(Canvas);
+		VSolidBrush    BackgroundBrush(VColor(30, 30, 30, 255));
+		VSolidBrush    GoodBrush(VColor(80, 220, 120, 255));
+		VSolidBrush    DroppedBrush(VColor(240, 80, 80, 255));
+		VSolidBrush    BudgetBrush(VColor(255, 255, 255, 255));
+
+		Device.SolidRectangle(&BackgroundBrush, FrameGraphRect);
+
+		for (int Count = 0; Count < VFrameStatistics::HistorySize; ++Count) {
+			long long FrameTime = Statistics.History[(Statistics.HistoryPosition + Count) % VFrameStatistics::HistorySize];
+			int       BarHeight = static_cast<int>(FrameTime * Height / (Budget * 2));
 
-				SizeOnChange.Emit(ResizedWidth, ResizedHeight);
+			BarHeight = BarHeight > Height ? Height : BarHeight;
 
-				Update(Surface()->Rect);
+			if (BarHeight <= 0) {
+				continue;
 			}
 
-			if (RepaintMessageStack.empty() == false) {
-				ObjectCanvas = new VCanvas(GetWidth(), GetHeight());
+			Device.SolidRectangle(FrameTime > Budget ? &DroppedBrush : &GoodBrush,
+				{ FrameGraphRect.left + Count * 2, FrameGraphRect.bottom - BarHeight,
+				  FrameGraphRect.left + Count * 2 + 2, FrameGraphRect.bottom });
+		}
 
-				for (auto& RepaintMessage : RepaintMessageStack) {
-					OnPaint(ObjectCanvas, RepaintMessage->DirtyRectangle);
+		Device.SolidRectangle(&BudgetBrush,
+			{ FrameGraphRect.left, FrameGraphRect.top + Height / 2, FrameGraphRect.right, FrameGraphRect.top + Height / 2 + 1 });
+	}
 
-					SendMessageToChild(RepaintMessage, false);
+public:
 
-					delete RepaintMessage;
-				}
+	/*
+	 * CheckFrame override Functional:
+	 *	@description  : Called On Each Ticked Frame Slot, Paint Only If There Is Damage
+	 *					( Animating Children Were Already Ticked By the Animation Registry )
+	*/
+	void CheckFrame() override {
+		if (Win32Resized == true) {
+			Win32Resized = false;
 
-				RepaintMessageStack.clear();
+			PresentDevice->Resize(ResizedWidth, ResizedHeight);
+			Resize(ResizedWidth, ResizedHeight);
 
-				VGdiplus::Graphics     FlushGraphics(GetImageHDC());
-				FlushGraphics.DrawImage(ObjectCanvas->GetNativeImage(), 0, 0);
+			SizeOnChange.Emit(ResizedWidth, ResizedHeight);
 
-				VFreeSourceMessage  GcMessage;
-				SendMessageToChild(&GcMessage, false);
+			Update(ObjectRect());
+		}
 
-				delete ObjectCanvas;
-			}
+		if (RepaintMessageStack.empty() == true) {
+			return;
+		}
 
-			for (auto& ChildObject : Kernel()->ChildObjectContainer) {
-				ChildObject->CheckAllFrame(true);
-			}
+		VProfileScope("Frame", "Frame");
+
+		FrameScheduler->BeginFrame();
+
+		ObjectCanvas = new VCanvas(GetWidth(), GetHeight());
+
+		for (auto& RepaintMessage : RepaintMessageStack) {
+			OnPaint(ObjectCanvas, RepaintMessage->DirtyRectangle);
 
+			FrameDisplayList.Begin(ObjectCanvas, RepaintMessage->DirtyRectangle);
 
-			FlushBatchDraw();
+			SendMessageToChild(RepaintMessage, false);
+
+			FrameDisplayList.End();
+
+			delete RepaintMessage;
+		}
+
+		RepaintMessageStack.clear();
+
+		if (FrameGraphVisible == true) {
+			PaintFrameGraph(ObjectCanvas);
 		}
+
+		PresentDevice->Present(ObjectCanvas);
+
+		/* Children Keep Their Canvas As Cached Layers For the Next Frames */
+
+		delete ObjectCanvas;
+
+		ObjectCanvas = nullptr;
+
+		FrameScheduler->EndFrame();
 	}
 };
 
@@ -0,0 +1,225 @@
+﻿/*
+ * VBlur.hpp
+ *	@description : A Fast Gaussian-like Blur On Locked Pixels ( Three Box Passes )
+ *	@birth		 : 2022/7.20
+*/
+
+#pragma once
+
+#include "vimage.hpp"
+
+#include "../../basic/vbasic/vthreadpool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define VBLUR_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VFastBlur class:
+ *	@description  : Three Box Blurs In a Row Approximate a Gaussian, Each Box Pass Is a Sliding
+ *					Sum So the Cost Does Not Grow With the Radius. Rows Are Blurred First, Then
+ *					Columns, Bands Of Lines Run On the Thread Pool
+*/
+class VFastBlur {
+private:
+	/* Lines Per Thread Pool Task */
+	static const int BandSize = 16;
+
+private:
+	/*
+	 * GetBoxRadius Functional:
+	 *	@description  : Split a Gaussian ( Sigma = Radius / 3 ) Into Three Box Radii
+	*/
+	static void GetBoxRadius(int Radius, int BoxRadius[3]) {
+		double Sigma = Radius / 3.0;
+		int    Lower = static_cast<int>(std::floor(std::sqrt(4.0 * Sigma * Sigma + 1.0)));
+
+		if (Lower % 2 == 0) {
+			--Lower;
+		}
+
+		int Upper       = Lower + 2;
+		int LowerCount  = static_cast<int>(std::round((12.0 * Sigma * Sigma - 3.0 * Lower * Lower - 12.0 * Lower - 9.0) /
+			(-4.0 * Lower - 4.0)));
+
+		for (int Count = 0; Count < 3; ++Count) {
+			BoxRadius[Count] = ((Count < LowerCount ? Lower : Upper) - 1) / 2;
+		}
+	}
+
+	/*
+	 * BoxLine Functional:
+	 *	@description  : One Box Pass Over a Line Of Premultiplied B, G, R, A Pixels, the Edges Are Extended
+	*/
+	static void BoxLine(const BYTE* Source, BYTE* Target, int Count, int Radius) {
+		int Last = Count - 1;
+
+#ifdef VBLUR_USE_SSE2
+		const __m128i Zero  = _mm_setzero_si128();
+		const __m128  Scale = _mm_set1_ps(1.f / static_cast<float>(2 * Radius + 1));
+
+		auto LoadPixel = [&](int Index) -> __m128i {
+			int Pixel;
+			memcpy(&Pixel, Source + Index * 4, 4);
+
+			return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(Pixel), Zero), Zero);
+		};
+		auto LoadClamped = [&](int Index) -> __m128i {
+			return LoadPixel(Index < 0 ? 0 : (Index > Last ? Last : Index));
+		};
+		auto StorePixel = [&](int X, __m128i Sum) {
+			__m128i Average = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(Sum), Scale));
+			Average         = _mm_packs_epi32(Average, Average);
+
+			int Pixel = _mm_cvtsi128_si32(_mm_packus_epi16(Average, Average));
+			memcpy(Target + X * 4, &Pixel, 4);
+		};
+
+		__m128i Sum = Zero;
+
+		for (int Index = -Radius; Index <= Radius; ++Index) {
+			Sum = _mm_add_epi32(Sum, LoadClamped(Index));
+		}
+
+		/* Only the Ends Of the Line Read Past the Edge, the Middle Needs No Clamping */
+		int MiddleBegin = (std::min)(Radius, Count);
+		int MiddleEnd   = (std::max)(MiddleBegin, Count - Radius - 1);
+
+		int X = 0;
+
+		for (; X < MiddleBegin; ++X) {
+			StorePixel(X, Sum);
+
+			Sum = _mm_add_epi32(Sum, _mm_sub_epi32(LoadClamped(X + Radius + 1), LoadClamped(X - Radius)));
+		}
+		for (; X < MiddleEnd; ++X) {
+			StorePixel(X, Sum);
+
+			Sum = _mm_add_epi32(Sum, _mm_sub_epi32(LoadPixel(X + Radius + 1), LoadPixel(X - Radius)));
+		}
+		for (; X < Count; ++X) {
+			StorePixel(X, Sum);
+
+			Sum = _mm_add_epi32(Sum, _mm_sub_epi32(LoadClamped(X + Radius + 1), LoadClamped(X - Radius)));
+		}
+#else
+		const float Scale = 1.f / static_cast<float>(2 * Radius + 1);
+
+		auto PixelAt = [&](int Index) -> const BYTE* {
+			return Source + (Index < 0 ? 0 : (Index > Last ? Last : Index)) * 4;
+		};
+
+		int Sum[4] = { 0, 0, 0, 0 };
+
+		for (int Index = -Radius; Index <= Radius; ++Index) {
+			for (int Channel = 0; Channel < 4; ++Channel) {
+				Sum[Channel] += PixelAt(Index)[Channel];
+			}
+		}
+
+		for (int X = 0; X < Count; ++X) {
+			for (int Channel = 0; Channel < 4; ++Channel) {
+				Target[X * 4 + Channel] = static_cast<BYTE>(Sum[Channel] * Scale + 0.5f);
+
+				Sum[Channel] += PixelAt(X + Radius + 1)[Channel] - PixelAt(X - Radius)[Channel];
+			}
+		}
+#endif
+	}
+	/*
+	 * BlurLine Functional:
+	 *	@description  : The Three Box Passes Over a Contiguous Line, Back Into the Line
+	*/
+	static void BlurLine(BYTE* Line, BYTE* Scratch, int Count, const int BoxRadius[3]) {
+		BoxLine(Line, Scratch, Count, BoxRadius[0]);
+		BoxLine(Scratch, Line, Count, BoxRadius[1]);
+		BoxLine(Line, Scratch, Count, BoxRadius[2]);
+
+		memcpy(Line, Scratch, static_cast<size_t>(Count) * 4);
+	}
+
+public:
+	/*
+	 * GetSupport Functional:
+	 *	@description  : How Far a Pixel Reaches Along Each Axis ( the Three Box Radii Added Up ),
+	 *					Blurring a Window Gives the Same Pixels As the Whole Image Once They Are
+	 *					This Far Inside Its Edges
+	*/
+	static int GetSupport(int Radius) {
+		if (Radius <= 0) {
+			return 0;
+		}
+
+		int BoxRadius[3];
+		GetBoxRadius(Radius, BoxRadius);
+
+		return BoxRadius[0] + BoxRadius[1] + BoxRadius[2];
+	}
+
+	/*
+	 * Apply Functional:
+	 *	@description  : Blur a 32bpp PARGB Pixel Area In Place ( Scan0 Is the Top-left Pixel Of the Area )
+	*/
+	static void Apply(BYTE* Scan0, ptrdiff_t Stride, int Width, int Height, int Radius) {
+		if (Width <= 0 || Height <= 0 || Radius <= 0) {
+			return;
+		}
+
+		VProfileScope("FastBlur", "Render");
+
+		int BoxRadius[3];
+		GetBoxRadius(Radius, BoxRadius);
+
+		int RowBands    = (Height + BandSize - 1) / BandSize;
+		int ColumnBands = (Width + BandSize - 1) / BandSize;
+
+		VThreadPool::Instance().ParallelFor(static_cast<size_t>(RowBands), [&](size_t Band) {
+			std::vector<BYTE> Scratch(static_cast<size_t>(Width) * 4);
+
+			int Bottom = (std::min)(Height, static_cast<int>(Band + 1) * BandSize);
+
+			for (int Y = static_cast<int>(Band) * BandSize; Y < Bottom; ++Y) {
+				BlurLine(Scan0 + Stride * Y, Scratch.data(), Width, BoxRadius);
+			}
+		});
+
+		/* Columns Are Gathered Into a Contiguous Line, Blurred, And Scattered Back */
+		VThreadPool::Instance().ParallelFor(static_cast<size_t>(ColumnBands), [&](size_t Band) {
+			std::vector<BYTE> Column(static_cast<size_t>(Height) * 4);
+			std::vector<BYTE> Scratch(static_cast<size_t>(Height) * 4);
+
+			int Right = (std::min)(Width, static_cast<int>(Band + 1) * BandSize);
+
+			for (int X = static_cast<int>(Band) * BandSize; X < Right; ++X) {
+				for (int Y = 0; Y < Height; ++Y) {
+					memcpy(Column.data() + Y * 4, Scan0 + Stride * Y + X * 4, 4);
+				}
+
+				BlurLine(Column.data(), Scratch.data(), Height, BoxRadius);
+
+				for (int Y = 0; Y < Height; ++Y) {
+					memcpy(Scan0 + Stride * Y + X * 4, Column.data() + Y * 4, 4);
+				}
+			}
+		});
+	}
+	/*
+	 * Apply Functional:
+	 *	@description  : Blur the Whole Locked Image In Place
+	*/
+	static void Apply(VImagePixels& Pixels, int Radius) {
+		if (Pixels.IsLocked() == true) {
+			Apply(Pixels.GetLine(0), Pixels.GetStride(), Pixels.GetWidth(), Pixels.GetHeight(), Radius);
+		}
+	}
+};
+
+VLIB_END_NAMESPACE
@@ -30,6 +30,8 @@ public:
 	 *	@description  : Paint a Canvas Into This Canvas
 	*/
 	void PaintCanvas(int X, int Y, VCanvas* Canvas) {
+		VProfileScope("PaintCanvas", "Composite");
+
 		VGdiplus::Graphics Graphics(GetNativeImage());
 
 		Graphics.DrawImage(Canvas->GetNativeImage(), 
@@ -0,0 +1,235 @@
+﻿/*
+ * VDisplayList.hpp
+ *	@description : Record the Canvas Composition Of a Frame And Replay It By Tiles
+ *	@birth		 : 2022/7.14
+*/
+
+#pragma once
+
+#include "vcanvas.hpp"
+#include "../../basic/vbasic/vthreadpool.hpp"
+
+#include <memory>
+#include <vector>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VDisplayItem struct:
+ *	@description  : One Recorded Composition ( Paint Canvas At X, Y With Transparency )
+*/
+struct VDisplayItem {
+	VCanvas* Canvas;
+
+	int      X;
+	int      Y;
+	int      Transparency;
+};
+
+/*
+ * VDisplayList class:
+ *	@description  : Objects Record Their Painted Canvas Instead Of Painting Directly,
+ *					the List Is Replayed Into the Target Canvas By Independent Screen Tiles
+ *					On the Worker Pool ( Only Inside the Damaged Aera )
+*/
+class VDisplayList {
+private:
+	std::vector<VDisplayItem> Items;
+
+	VCanvas*                  TargetCanvas = nullptr;
+	VRect                     TargetAera;
+
+	int                       TileSize = 128;
+
+private:
+	/*
+	 * MultiplyAlpha Functional:
+	 *	@description  : Value * Alpha / 255 ( Rounded )
+	*/
+	static inline unsigned int MultiplyAlpha(unsigned int Value, unsigned int Alpha) {
+		unsigned int Temp = Value * Alpha + 128;
+
+		return (Temp + (Temp >> 8)) >> 8;
+	}
+
+public:
+	/*
+	 * BlendLine Functional:
+	 *	@description  : Source-over Blend a Line Of PARGB Pixels With Extra Transparency
+	*/
+	static void BlendLine(BYTE* Target, const BYTE* Source, int Count, int Transparency) {
+		for (int Pixel = 0; Pixel < Count; ++Pixel, Target += 4, Source += 4) {
+			unsigned int SourceB = Source[0];
+			unsigned int SourceG = Source[1];
+			unsigned int SourceR = Source[2];
+			unsigned int SourceA = Source[3];
+
+			if (Transparency != 255) {
+				SourceB = MultiplyAlpha(SourceB, Transparency);
+				SourceG = MultiplyAlpha(SourceG, Transparency);
+				SourceR = MultiplyAlpha(SourceR, Transparency);
+				SourceA = MultiplyAlpha(SourceA, Transparency);
+			}
+
+			if (SourceA == 0) {
+				continue;
+			}
+			if (SourceA == 255) {
+				Target[0] = static_cast<BYTE>(SourceB);
+				Target[1] = static_cast<BYTE>(SourceG);
+				Target[2] = static_cast<BYTE>(SourceR);
+				Target[3] = 255;
+
+				continue;
+			}
+
+			unsigned int Rest = 255 - SourceA;
+
+			Target[0] = static_cast<BYTE>(SourceB + MultiplyAlpha(Target[0], Rest));
+			Target[1] = static_cast<BYTE>(SourceG + MultiplyAlpha(Target[1], Rest));
+			Target[2] = static_cast<BYTE>(SourceR + MultiplyAlpha(Target[2], Rest));
+			Target[3] = static_cast<BYTE>(SourceA + MultiplyAlpha(Target[3], Rest));
+		}
+	}
+
+private:
+	/*
+	 * ReplaySerial Functional:
+	 *	@description  : Fallback Replay With Gdiplus When the Pixels Can't Be Locked
+	*/
+	void ReplaySerial(VRect Aera) {
+		VGdiplus::Graphics Graphics(TargetCanvas->GetNativeImage());
+
+		Graphics.SetClip(Aera.ToGdiplusRect());
+
+		for (auto& Item : Items) {
+			Graphics.DrawImage(Item.Canvas->GetNativeImage(),
+				{ Item.X, Item.Y, Item.Canvas->GetWidth(), Item.Canvas->GetHeight() },
+				0, 0, Item.Canvas->GetWidth(), Item.Canvas->GetHeight(), VGdiplus::UnitPixel, Item.Canvas->GetNativeAttributes());
+		}
+	}
+
+public:
+	/*
+	 * SetTileSize Functional:
+	 *	@description  : Set the Edge Length Of a Screen Tile
+	*/
+	void SetTileSize(int Size) {
+		TileSize = Size > 16 ? Size : 16;
+	}
+
+	/*
+	 * Begin Functional:
+	 *	@description  : Start Recording For a Damaged Aera Of Target Canvas
+	*/
+	void Begin(VCanvas* Target, VRect Aera) {
+		TargetCanvas = Target;
+		TargetAera   = Aera.Intersect({ 0, 0, Target->GetWidth(), Target->GetHeight() });
+
+		Items.clear();
+	}
+	/*
+	 * IsRecording Functional:
+	 *	@description  : Is the List Recording Now
+	*/
+	bool IsRecording() const {
+		return TargetCanvas != nullptr;
+	}
+
+	/*
+	 * Record Functional:
+	 *	@description  : Record a Canvas Composition, the Canvas Must Alive Until Next Flush
+	*/
+	void Record(VCanvas* Canvas, int X, int Y, int Transparency) {
+		VRect CanvasRect(X, Y, X + Canvas->GetWidth(), Y + Canvas->GetHeight());
+
+		if (Transparency <= 0 || CanvasRect.Intersect(TargetAera).IsEmpty() == true) {
+			return;
+		}
+
+		Items.push_back({ Canvas, X, Y, Transparency > 255 ? 255 : Transparency });
+	}
+
+	/*
+	 * Flush Functional:
+	 *	@description  : Replay the Recorded Items Into Target Canvas ( Tile Parallel ) And Clear Them,
+	 *					Objects Which Read the Backdrop Should Flush Before Painting
+	*/
+	void Flush() {
+		if (Items.empty() == true || TargetAera.IsEmpty() == true) {
+			Items.clear();
+
+			return;
+		}
+
+		VProfileScope("DisplayListFlush", "Composite");
+
+		std::vector<std::unique_ptr<VImagePixels>> SourcePixels;
+		bool                                       LockSucceed = true;
+
+		for (auto& Item : Items) {
+			SourcePixels.emplace_back(new VImagePixels(Item.Canvas, true));
+
+			LockSucceed = LockSucceed && SourcePixels.back()->IsLocked();
+		}
+
+		std::unique_ptr<VImagePixels> TargetPixels;
+		if (LockSucceed == true) {
+			TargetPixels.reset(new VImagePixels(TargetCanvas));
+
+			LockSucceed = TargetPixels->IsLocked();
+		}
+
+		if (LockSucceed == false) {
+			TargetPixels.reset();
+			SourcePixels.clear();
+
+			ReplaySerial(TargetAera);
+
+			Items.clear();
+
+			return;
+		}
+
+		int Columns = (TargetAera.GetWidth() + TileSize - 1) / TileSize;
+		int Rows    = (TargetAera.GetHeight() + TileSize - 1) / TileSize;
+
+		VThreadPool::Instance().ParallelFor(static_cast<size_t>(Columns) * Rows, [&](size_t Tile) {
+			int   TileX = TargetAera.left + static_cast<int>(Tile % Columns) * TileSize;
+			int   TileY = TargetAera.top + static_cast<int>(Tile / Columns) * TileSize;
+
+			VRect TileRect = VRect(TileX, TileY, TileX + TileSize, TileY + TileSize).Intersect(TargetAera);
+
+			for (size_t Count = 0; Count < Items.size(); ++Count) {
+				auto& Item = Items[Count];
+
+				VRect PaintRect = VRect(Item.X, Item.Y,
+					Item.X + SourcePixels[Count]->GetWidth(), Item.Y + SourcePixels[Count]->GetHeight()).Intersect(TileRect);
+
+				if (PaintRect.IsEmpty() == true) {
+					continue;
+				}
+
+				for (int Y = PaintRect.top; Y < PaintRect.bottom; ++Y) {
+					BlendLine(TargetPixels->GetLine(Y) + PaintRect.left * 4,
+						SourcePixels[Count]->GetLine(Y - Item.Y) + (PaintRect.left - Item.X) * 4,
+						PaintRect.GetWidth(), Item.Transparency);
+				}
+			}
+		});
+
+		Items.clear();
+	}
+
+	/*
+	 * End Functional:
+	 *	@description  : Flush the Rest Items And Stop Recording
+	*/
+	void End() {
+		Flush();
+
+		TargetCanvas = nullptr;
+	}
+};
+
+VLIB_END_NAMESPACE
@@ -106,6 +106,9 @@ public:
 	VFontFormat() {
 		NativeFormat.reset(new VGdiplus::StringFormat());
 	}
+	VFontFormat(const VFontFormat& Format) {
+		NativeFormat.reset(Format.NativeFormat->Clone());
+	}
 
 public:
 	/*
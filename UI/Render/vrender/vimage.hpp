@@ -10,6 +10,8 @@
 #include "vcolor.hpp"
 #include "vpainterdevice.hpp"
 
+#include "../../basic/vbasic/vprofiler.hpp"
+
 VLIB_BEGIN_NAMESPACE
 
 /*
@@ -21,6 +23,8 @@ private:
 	VMemoryPtr<VGdiplus::ImageAttributes>    NativeAttributes;
 	VMemoryPtr<VGdiplus::Bitmap>             NativeImage;
 
+	int                                      ImageTransparency = 255;
+
 private:
 	void InitAttribute() {
 		VGdiplus::ColorMatrix Matrix = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
@@ -89,6 +93,14 @@ public:
 		return NativeImage->GetHeight();
 	}
 
+	/*
+	 * IsOpaque Functional:
+	 *	@description  : Is Every Pixel Drawn Fully Opaque ( No Alpha Channel, No Transparency Set )
+	*/
+	bool IsOpaque() {
+		return VGdiplus::IsAlphaPixelFormat(NativeImage->GetPixelFormat()) == FALSE && ImageTransparency == 255;
+	}
+
 public:
 	/*
 	 * Build up functional
@@ -111,6 +123,7 @@ public:
 		));
 
 		NativeAttributes.reset(Object.NativeAttributes->Clone());
+		ImageTransparency = Object.ImageTransparency;
 	}
 
 	VImage(int Width, int Height)
@@ -120,6 +133,13 @@ public:
 		NativeAttributes.reset(new VGdiplus::ImageAttributes);
 		InitAttribute();
 	}
+	VImage(int Width, int Height, bool AlphaChannel)
+		: VPaintbleObject(VPaintbleType::ImagePainter) {
+		NativeImage.reset(new VGdiplus::Bitmap(Width, Height, AlphaChannel == true ? PixelFormat32bppPARGB : PixelFormat32bppRGB));
+
+		NativeAttributes.reset(new VGdiplus::ImageAttributes);
+		InitAttribute();
+	}
 
 	VImage(HICON IconHandle)
 		: VPaintbleObject(VPaintbleType::ImagePainter) {
@@ -145,6 +165,8 @@ public:
 
 	VImage(std::wstring FilePath)
 		: VPaintbleObject(VPaintbleType::ImagePainter) {
+		VProfileScope("Decode", "Image");
+
 		NativeImage.reset(new VGdiplus::Bitmap(FilePath.c_str(), PixelFormat32bppPARGB));
 
 		NativeAttributes.reset(new VGdiplus::ImageAttributes);
@@ -205,6 +227,8 @@ public:
 	 *	@description  : Set the Transparency Of Image
 	*/
 	void SetTransparency(int Transparency) {
+		ImageTransparency = Transparency;
+
 		VGdiplus::ColorMatrix ColorMatrix = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
 						   0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
 						   0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
@@ -215,4 +239,66 @@ public:
 	}
 };
 
+/*
+ * VImagePixels class:
+ *	@description  : Lock the Whole Image As 32bpp PARGB For Bulk Pixel Access,
+ *					Unlock When Destructed
+*/
+class VImagePixels {
+private:
+	VGdiplus::Bitmap*    NativeImage;
+	VGdiplus::BitmapData NativeData;
+
+	bool                 Locked = false;
+
+public:
+	/*
+	 * Build up & Deleter Functional
+	*/
+
+	VImagePixels(VImage* Image, bool ReadOnly = false) {
+		NativeImage = Image->GetNativeImage();
+
+		VGdiplus::Rect LockRect(0, 0, Image->GetWidth(), Image->GetHeight());
+
+		Locked = NativeImage->LockBits(&LockRect,
+			ReadOnly ? VGdiplus::ImageLockModeRead : (VGdiplus::ImageLockModeRead | VGdiplus::ImageLockModeWrite),
+			PixelFormat32bppPARGB, &NativeData) == VGdiplus::Ok;
+	}
+	~VImagePixels() {
+		if (Locked == true) {
+			NativeImage->UnlockBits(&NativeData);
+		}
+	}
+
+	VImagePixels(const VImagePixels&) = delete;
+	void operator=(const VImagePixels&) = delete;
+
+	/*
+	 * IsLocked Functional:
+	 *	@description  : Is the Pixels Available
+	*/
+	bool IsLocked() const {
+		return Locked;
+	}
+
+	int GetWidth() const {
+		return static_cast<int>(NativeData.Width);
+	}
+	int GetHeight() const {
+		return static_cast<int>(NativeData.Height);
+	}
+	ptrdiff_t GetStride() const {
+		return static_cast<ptrdiff_t>(NativeData.Stride);
+	}
+
+	/*
+	 * GetLine Functional:
+	 *	@description  : Get the Pixels Of a Line ( Each Pixel Is B, G, R, A Premultiplied )
+	*/
+	BYTE* GetLine(int Y) const {
+		return static_cast<BYTE*>(NativeData.Scan0) + static_cast<ptrdiff_t>(NativeData.Stride) * Y;
+	}
+};
+
 VLIB_END_NAMESPACE
\ No newline at end of file
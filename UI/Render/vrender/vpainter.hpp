@@ -47,6 +47,16 @@ public:
 		NativeGraphics->SetInterpolationMode(VGdiplus::InterpolationMode::InterpolationModeDefault);
 	}
 
+	/*
+	 * SetHighQualityInterpolation Functional:
+	 *	@description  : Scale Images With High Quality Bicubic, Or With the Fast Low Quality Filter
+	*/
+	void SetHighQualityInterpolation(bool HighQuality) {
+		NativeGraphics->SetInterpolationMode(HighQuality == true ?
+			VGdiplus::InterpolationMode::InterpolationModeHighQualityBicubic :
+			VGdiplus::InterpolationMode::InterpolationModeLowQuality);
+	}
+
 	/*
 	 * Draw Functional
 	*/
@@ -0,0 +1,248 @@
+﻿/*
+ * VPresentDevice.hpp
+ *	@description : The Devices Which Show the Painted Frames ( Window Or Memory )
+ *	@birth		 : 2022/7.16
+*/
+
+#pragma once
+
+#include "vcanvas.hpp"
+
+#include <cstdio>
+#include <vector>
+
+VLIB_BEGIN_NAMESPACE
+
+/*
+ * VPresentDevice class:
+ *	@description  : The Backend-neutral Present Interface, a Frame Canvas Only Holds the Damaged Pixels
+ *					( Others Are Transparent ), So Present Should Composite It Over the Last Frame
+*/
+class VPresentDevice {
+public:
+	virtual ~VPresentDevice() {
+
+	}
+
+	/*
+	 * GetWindowHandle virtual Functional:
+	 *	@description  : Get the Win32 Window, nullptr If the Device Is Headless
+	*/
+	virtual HWND GetWindowHandle() = 0;
+	/*
+	 * GetRefreshRate virtual Functional:
+	 *	@description  : Get the Refresh Rate Of the Device ( Frames Per Second )
+	*/
+	virtual int  GetRefreshRate() = 0;
+
+	/*
+	 * Resize virtual Functional:
+	 *	@description  : Resize the Present Surface
+	*/
+	virtual void Resize(int Width, int Height) = 0;
+	/*
+	 * Present virtual Functional:
+	 *	@description  : Show a Painted Frame
+	*/
+	virtual void Present(VCanvas* Frame) = 0;
+};
+
+/*
+ * VEasyXPresentDevice class <- public VPresentDevice:
+ *	@description  : Present Into the EasyX Window
+*/
+class VEasyXPresentDevice : public VPresentDevice {
+private:
+	HWND WindowHandle;
+
+public:
+	/*
+	 * Build up & Deleter Functional
+	*/
+
+	VEasyXPresentDevice(int Width, int Height) {
+		WindowHandle = initgraph(Width, Height, EW_SHOWCONSOLE);
+
+		BeginBatchDraw();
+	}
+	~VEasyXPresentDevice() override {
+		EndBatchDraw();
+	}
+
+public:
+	HWND GetWindowHandle() override {
+		return WindowHandle;
+	}
+	int  GetRefreshRate() override {
+		HDC WindowDC    = GetDC(WindowHandle);
+		int RefreshRate = GetDeviceCaps(WindowDC, VREFRESH);
+
+		ReleaseDC(WindowHandle, WindowDC);
+
+		return RefreshRate;
+	}
+
+	void Resize(int Width, int Height) override {
+		EasyXWindowResize(Width, Height);
+	}
+	void Present(VCanvas* Frame) override {
+		{
+			VProfileScope("FlushToScreen", "Present");
+
+			VGdiplus::Graphics FlushGraphics(GetImageHDC());
+			FlushGraphics.DrawImage(Frame->GetNativeImage(), 0, 0);
+		}
+
+		VProfileScope("FlushBatchDraw", "Present");
+
+		FlushBatchDraw();
+	}
+};
+
+/*
+ * VOffscreenPresentDevice class <- public VPresentDevice:
+ *	@description  : Present Into a Memory Frame Buffer ( No Window ), For Headless Runs And Benchmarks,
+ *					the Frame Buffer Could Be Dumped As PPM Or PNG
+*/
+class VOffscreenPresentDevice : public VPresentDevice {
+private:
+	VMemoryPtr<VCanvas> FrameBuffer;
+
+	unsigned long long  PresentCount = 0;
+	int                 RefreshRate;
+
+private:
+	/*
+	 * GetEncoderClsid Functional:
+	 *	@description  : Find the Gdiplus Encoder Of a Mime Type
+	*/
+	static bool GetEncoderClsid(const wchar_t* MimeType, CLSID* Clsid) {
+		UINT EncoderCount = 0;
+		UINT EncoderSize  = 0;
+
+		VGdiplus::GetImageEncodersSize(&EncoderCount, &EncoderSize);
+
+		if (EncoderSize == 0) {
+			return false;
+		}
+
+		std::vector<BYTE>        EncoderBuffer(EncoderSize);
+		VGdiplus::ImageCodecInfo* Encoders = reinterpret_cast<VGdiplus::ImageCodecInfo*>(EncoderBuffer.data());
+
+		VGdiplus::GetImageEncoders(EncoderCount, EncoderSize, Encoders);
+
+		for (UINT Count = 0; Count < EncoderCount; ++Count) {
+			if (wcscmp(Encoders[Count].MimeType, MimeType) == 0) {
+				*Clsid = Encoders[Count].Clsid;
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+public:
+	/*
+	 * Build up Functional
+	*/
+
+	VOffscreenPresentDevice(int Width, int Height, int DeviceRefreshRate = 60)
+		: RefreshRate(DeviceRefreshRate) {
+		FrameBuffer.reset(new VCanvas(Width, Height));
+	}
+
+public:
+	HWND GetWindowHandle() override {
+		return nullptr;
+	}
+	int  GetRefreshRate() override {
+		return RefreshRate;
+	}
+
+	void Resize(int Width, int Height) override {
+		VCanvas* OldBuffer = FrameBuffer.release();
+
+		FrameBuffer.reset(new VCanvas(Width, Height));
+		FrameBuffer->PaintCanvas(0, 0, OldBuffer);
+
+		delete OldBuffer;
+	}
+	void Present(VCanvas* Frame) override {
+		VProfileScope("FlushToMemory", "Present");
+
+		FrameBuffer->PaintCanvas(0, 0, Frame);
+
+		++PresentCount;
+	}
+
+	/*
+	 * GetFrameBuffer Functional:
+	 *	@description  : Get the Presented Pixels
+	*/
+	VCanvas* GetFrameBuffer() {
+		return FrameBuffer.get();
+	}
+	/*
+	 * GetPresentCount Functional:
+	 *	@description  : How Many Frames Have Been Presented
+	*/
+	unsigned long long GetPresentCount() {
+		return PresentCount;
+	}
+
+	/*
+	 * DumpPPM Functional:
+	 *	@description  : Write the Frame Buffer As a Binary PPM ( Alpha Is Dropped )
+	 *	@return value : Succeed Or Not
+	*/
+	bool DumpPPM(std::wstring FilePath) {
+		VImagePixels Pixels(FrameBuffer.get(), true);
+
+		if (Pixels.IsLocked() == false) {
+			return false;
+		}
+
+		FILE* File = _wfopen(FilePath.c_str(), L"wb");
+
+		if (File == nullptr) {
+			return false;
+		}
+
+		fprintf(File, "P6\n%d %d\n255\n", Pixels.GetWidth(), Pixels.GetHeight());
+
+		std::vector<BYTE> Line(static_cast<size_t>(Pixels.GetWidth()) * 3);
+
+		for (int Y = 0; Y < Pixels.GetHeight(); ++Y) {
+			BYTE* Source = Pixels.GetLine(Y);
+
+			for (int X = 0; X < Pixels.GetWidth(); ++X, Source += 4) {
+				Line[X * 3]     = Source[2];
+				Line[X * 3 + 1] = Source[1];
+				Line[X * 3 + 2] = Source[0];
+			}
+
+			fwrite(Line.data(), 1, Line.size(), File);
+		}
+
+		fclose(File);
+
+		return true;
+	}
+	/*
+	 * DumpPNG Functional:
+	 *	@description  : Write the Frame Buffer As PNG ( Gdiplus Encoder )
+	 *	@return value : Succeed Or Not
+	*/
+	bool DumpPNG(std::wstring FilePath) {
+		CLSID PngClsid;
+
+		if (GetEncoderClsid(L"image/png", &PngClsid) == false) {
+			return false;
+		}
+
+		return FrameBuffer->GetNativeImage()->Save(FilePath.c_str(), &PngClsid, nullptr) == VGdiplus::Ok;
+	}
+};
+
+VLIB_END_NAMESPACE